@@ -3,6 +3,19 @@
 #include<vector>
 #include<fstream>
 #include<sstream>
+#include<cstdint>
+#include<cstring>
+#include<algorithm>
+#include<atomic>
+#include<thread>
+#include<memory>
+#include<mutex>
+#include<condition_variable>
+#include<deque>
+#include<bit>
+#include<functional>
+#include<chrono>
+#include<limits>
 
 // GLAD OpenGL 4.6 Loader
 #include<glad/gl.h>
@@ -14,6 +27,17 @@
 // OpenGL Mathematics - GLM
 #include<glm/glm.hpp>
 #include<glm/gtc/matrix_transform.hpp>
+#include<glm/gtc/packing.hpp>
+
+// SIMD Intrinsics
+#if defined(__SSE__) || defined(__AVX__)
+#include<immintrin.h>
+#endif
+
+// glibc Heap Trimming
+#if defined(__GLIBC__)
+#include<malloc.h>
+#endif
 
 // STB
 #include<stb_image.h>
@@ -26,12 +50,15 @@
 // Namespace
 namespace sgl {
     // Shader
-    enum ShaderType {VertexShader, FragmentShader, GeometryShader};
+    enum ShaderType {VertexShader, FragmentShader, GeometryShader, ComputeShader};
     class Shader {
         public:
             // Attach Shader
             void attachShader(const std::string &shaderFilePath, const sgl::ShaderType &shaderType);
 
+            // Attach Shader From Source in Memory - For Generated Shaders
+            void attachShaderSource(const std::string &shaderSource, const sgl::ShaderType &shaderType);
+
             // Link Shader Program and Check For Link Errors
             void link(void);
 
@@ -47,6 +74,7 @@ namespace sgl {
 
             void setVec2(const std::string &uniformVarName, const glm::vec2 &value);
             void setVec2(const std::string &uniformVarName, const float &a, const float &b);
+            void setIVec2(const std::string &uniformVarName, const glm::ivec2 &value);
 
             void setVec3(const std::string &uniformVarName, const glm::vec3 &value);
             void setVec3(const std::string &uniformVarName, const float &a, const float &b, const float &c);
@@ -55,11 +83,19 @@ namespace sgl {
             void setVec4(const std::string &uniformVarName, const float &a, const float &b, const float &c, const float &d);
 
             void setMat4(const std::string &uniformVarName, const glm::mat4 &value);
+
+            void setFloatArray(const std::string &uniformVarName, const std::vector<float> &values);
+
+            // Getters
+            GLuint getProgram(void);
         private:
             // Shaders - Shader Program
             GLuint shaderProgram {glCreateProgram()};
     };
 
+    // Shader Programs That Failed to Link Since Startup - Lets Headless Tools Refuse to Report Results Measured Without Them
+    unsigned int getFailedShaderProgramCount(void);
+
     // Texture
     class Texture {
         public:
@@ -99,6 +135,7 @@ namespace sgl {
             // Binders
             void bind(const GLenum &bindTarget);
             void bindColorBufferTex(void);
+            void bindDepthStencilTex(void);
 
             // Unbind Framebuffer Object
             void unbind(void);
@@ -114,16 +151,282 @@ namespace sgl {
             unsigned int msaaSamples;
 
             // Framebuffer Object
-            GLuint framebuffer;
+            GLuint framebuffer {0};
 
             // Color Buffer Texture
-            GLuint colorBufferTex;
+            GLuint colorBufferTex {0};
 
             // Renderbuffer Object - Depth and Stencil Buffer
-            GLuint renderBuffer;
+            GLuint renderBuffer {0};
 
             // Depth and Stencil Buffer Texture - Alternative to Renderbuffer
-            GLuint depthStencilTex;
+            GLuint depthStencilTex {0};
+    };
+
+    // Render Target Descriptor - Targets Are Only Shared Between Identical Descriptors
+    // Formats Must Be Sized Internal Formats, 0 Leaves The Attachment Out - 0 Samples is Single Sampled
+    struct RenderTargetDesc {
+        unsigned int width {0}, height {0};
+        GLenum colorFormat {0}, depthFormat {0};
+        unsigned int samples {0};
+
+        bool operator==(const sgl::RenderTargetDesc &other) const = default;
+    };
+
+    // Render Target - Framebuffer With Immutable Color and/or Depth Textures, Owned by A Render Target Pool
+    struct RenderTarget {
+        sgl::RenderTargetDesc desc;
+        GLuint framebuffer {0}, colorTexture {0}, depthTexture {0};
+        std::size_t memorySize {0};
+
+        // Pool Bookkeeping
+        bool inUse {false};
+        std::uint64_t lastUsedFrame {0};
+
+        // Binders - Textures Are Bound to The Active Texture Unit
+        void bind(const GLenum &bindTarget);
+        void bindColorTexture(void);
+        void bindDepthTexture(void);
+    };
+
+    // Render Target Pool - Hands Out Transient Render Targets by Descriptor and Reuses Them Across Passes and Frames
+    // Targets Nobody Acquired For maxIdleFrames Frames Are Destroyed, So Resizing Recreates Targets Lazily at The New Size
+    class RenderTargetPool {
+        public:
+            // Constructor
+            RenderTargetPool(const unsigned int &maxIdleFrames);
+
+            // Start A Frame - Destroys Targets Idle For Too Long
+            void beginFrame(void);
+
+            // Acquire A Free Target Matching The Descriptor, Creating One if There is None - Release It When The Pass Reading It is Done
+            sgl::RenderTarget* acquire(const sgl::RenderTargetDesc &desc);
+            void release(sgl::RenderTarget* target);
+
+            // Getters - Estimated Video Memory in Bytes, Live Targets and Targets Created Since Construction
+            std::size_t getMemoryUsage(void);
+            std::size_t getTargetCount(void);
+            std::uint64_t getCreatedCount(void);
+
+            // Destroy Render Target Pool - Destroys Every Target
+            void destroy(void);
+        private:
+            // Targets - Heap Allocated So Acquired Pointers Stay Valid While The Pool Grows
+            std::vector<std::unique_ptr<sgl::RenderTarget>> targets;
+            std::uint64_t frameIndex {0}, createdCount {0};
+            unsigned int maxIdleFrames;
+
+            // Create/Destroy A Target's OpenGL Objects
+            void create(sgl::RenderTarget &target);
+            void free(sgl::RenderTarget &target);
+    };
+
+    // Job Counter - Number of Unfinished Jobs Tied to It and The Jobs Depending on It, Which Are Queued Once It Reaches Zero
+    struct Job;
+    struct JobCounter {
+        std::atomic<unsigned int> pending {0};
+        std::mutex dependentsMutex;
+        std::vector<sgl::Job*> dependents;
+    };
+
+    // Job - A Task and The Counter It Signals When Done, Pooled Per Thread (Heap Allocated From Non-Job Threads or When The Pool Slot is Busy)
+    // Background Jobs Are Spawned From Non-Job Threads (Loaders) and Only Run by Idle Workers or Non-Job Threads
+    struct Job {
+        std::function<void(void)> task;
+        sgl::JobCounter* counter {nullptr};
+        bool heapAllocated {false}, background {false};
+        std::atomic<bool> inUse {false};
+    };
+
+    // Chase-Lev Work-Stealing Deque - The Owning Thread Pushes/Pops at The Bottom, Other Threads Steal From The Top Without Locks
+    class JobDeque {
+        public:
+            // Owner Only - Push Fails When Full
+            bool push(sgl::Job* job);
+            sgl::Job* pop(void);
+
+            // Any Thread
+            sgl::Job* steal(void);
+        private:
+            static const std::int64_t capacity {4096};
+            std::atomic<std::int64_t> top {0}, bottom {0};
+            std::atomic<sgl::Job*> jobs[capacity];
+    };
+
+    // Job Thread - Deque and Job Pool of The Main Thread (Index 0) or A Worker Thread
+    struct JobThread {
+        static const std::size_t poolSize {4096};
+        sgl::JobDeque deque;
+        std::unique_ptr<sgl::Job[]> pool {std::make_unique<sgl::Job[]>(poolSize)};
+        std::size_t nextJob {0};
+        std::thread thread;
+    };
+
+    // Job System - Work-Stealing Worker Threads, The Constructing Thread Becomes The Main Thread and Runs Main Thread Affine (OpenGL) Jobs
+    class JobSystem {
+        public:
+            // Constructor - Start Worker Threads, 0 Uses All Hardware Threads But The Main One
+            JobSystem(const unsigned int &workerCount);
+
+            // Run A Job on Any Thread - The Counter (Optional) is Decremented Once It Finishes
+            void run(const std::function<void(void)> &task, sgl::JobCounter* counter);
+
+            // Run A Job Once A Dependency Counter Reaches Zero - It Isn't Queued Before, So No Thread Blocks on It
+            void run(const std::function<void(void)> &task, sgl::JobCounter* counter, sgl::JobCounter* dependency);
+
+            // Run A Job on The Main Thread - Executed by runMainThreadJobs or While The Main Thread Waits
+            void runOnMainThread(const std::function<void(void)> &task, sgl::JobCounter* counter);
+            void runMainThreadJobs(void);
+
+            // Wait Until A Counter Reaches Zero - The Waiting Thread Runs Other Jobs Meanwhile, Job Threads Skip Background Jobs So A Frame Never Absorbs One
+            void wait(sgl::JobCounter &counter);
+
+            // Split [0, count) Into Chunks of grainSize and Run Them in Parallel, Returns Once All Are Done
+            void parallelFor(const std::size_t &count, const std::size_t &grainSize, const std::function<void(const std::size_t &begin, const std::size_t &end)> &function);
+
+            // Getters
+            unsigned int getWorkerCount(void);
+
+            // Destroy Job System - Stops and Joins The Workers, Must Be Called on The Main Thread With No Jobs Left
+            void destroy(void);
+        private:
+            // Main Thread and Worker Threads
+            std::vector<std::unique_ptr<sgl::JobThread>> threads;
+
+            // Jobs Overflowing A Full Deque, Background Jobs Spawned From Threads Outside The Job System and Main Thread Affine Jobs
+            std::mutex externalMutex, mainThreadMutex;
+            std::deque<sgl::Job*> externalJobs, backgroundJobs, mainThreadJobs;
+
+            // Sleeping Workers Are Woken When Jobs Are Queued
+            std::atomic<unsigned int> queuedJobs {0}, sleepingWorkers {0};
+            std::mutex sleepMutex;
+            std::condition_variable sleepCondition;
+            std::atomic<bool> stopping {false};
+
+            // Allocate/Queue/Run Jobs
+            sgl::Job* allocate(const std::function<void(void)> &task, sgl::JobCounter* counter);
+            void queue(sgl::Job* job);
+            void release(sgl::JobCounter* counter);
+            bool tryRunJob(const bool &background);
+            void execute(sgl::Job* job);
+            void workerMain(const unsigned int &threadIndex);
+    };
+
+    // Bounding Volumes
+    struct BoundingBox {
+        glm::vec3 min {0.0f}, max {0.0f};
+    };
+    struct BoundingSphere {
+        glm::vec3 center {0.0f};
+        float radius {0.0f};
+    };
+
+    // Bounding Box List - Centers and Half Extents Stored as Structure of Arrays For SIMD Culling
+    struct BoundingBoxList {
+        std::vector<float> centerX, centerY, centerZ;
+        std::vector<float> extentX, extentY, extentZ;
+
+        // Add A Bounding Box
+        void add(const sgl::BoundingBox &box);
+
+        // Number of Bounding Boxes/Clear All Bounding Boxes
+        std::size_t size(void) const;
+        void clear(void);
+    };
+
+    // Meshlet - A Cluster of At Most 64 Vertices and 124 Triangles, Contiguous in Its Mesh's Index Buffer
+    // Normal Cone - The Cluster Faces Away From Every Viewer Inside The Cone Around -coneAxis, coneCutoff is The Sine of The Normals' Spread
+    struct Meshlet {
+        GLuint firstIndex {0};
+        GLsizei indexCount {0};
+        sgl::BoundingSphere boundingSphere;
+        glm::vec3 coneAxis {0.0f};
+        float coneCutoff {1.0f};
+    };
+
+    // Meshlet Bounds List - Bounding Spheres and Normal Cones Stored as Structure of Arrays For SIMD Culling
+    struct MeshletBoundsList {
+        std::vector<float> centerX, centerY, centerZ, radius;
+        std::vector<float> coneAxisX, coneAxisY, coneAxisZ, coneCutoff;
+
+        // Add A Meshlet's Bounds
+        void add(const sgl::Meshlet &meshlet);
+
+        // Number of Meshlets/Clear All Meshlet Bounds
+        std::size_t size(void) const;
+        void clear(void);
+    };
+
+    // Culling Stats - Reset Every Frame
+    struct CullStats {
+        unsigned int visible {0}, culled {0};
+        unsigned int clustersVisible {0}, clustersCulled {0};
+    };
+
+    // View Frustum - Planes Extracted From A Projection * View (* Model) Matrix, Bounds Are Tested in That Matrix's Input Space
+    class Frustum {
+        public:
+            // Constructor - Extract and Normalize The Six Frustum Planes
+            Frustum(const glm::mat4 &matrix);
+
+            // Test A Single Bounding Volume - True if Potentially Visible
+            bool testBox(const sgl::BoundingBox &box) const;
+            bool testSphere(const sgl::BoundingSphere &sphere) const;
+
+            // Cull A List of Bounding Boxes - 8 (AVX) or 4 (SSE) at A Time, Appends Indices of Potentially Visible Boxes
+            void cullBoxes(const sgl::BoundingBoxList &boxes, std::vector<unsigned int> &visible) const;
+
+            // Cull A List of Meshlets Against The Frustum and Their Normal Cones - 4 (SSE) at A Time, The Camera Position Must Be in The Frustum's Input Space
+            void cullMeshlets(const sgl::MeshletBoundsList &meshlets, const glm::vec3 &cameraPosition, std::vector<unsigned int> &visible) const;
+
+            // Getters
+            const glm::vec4& getPlane(const unsigned int &index) const;
+        private:
+            // Left, Right, Bottom, Top, Near and Far Planes - xyz is The Inward Facing Normal, w is The Distance
+            glm::vec4 planes[6];
+    };
+
+    // Scene Bounding Volume Hierarchy - Binned SAH Build Over Instance Bounding Boxes, Stored as A Flat Node Array
+    struct BVHNode {
+        // Node Bounds - Left Child/First Instance Index and Instance Count (0 For Interior Nodes, Right Child is Left Child + 1)
+        glm::vec3 boundsMin;
+        unsigned int leftFirst;
+        glm::vec3 boundsMax;
+        unsigned int count;
+    };
+    struct RayHit {
+        unsigned int instance {0};
+        float distance {0.0f};
+    };
+    class SceneBVH {
+        public:
+            // Build BVH Over Instance Bounding Boxes - Instance Indices Are Positions in The Given List
+            void build(const std::vector<sgl::BoundingBox> &instanceBounds);
+
+            // Update A Moving Instance's Bounding Box - Call refit Afterwards, Rebuild if Instances Moved Far
+            void setInstanceBounds(const unsigned int &instance, const sgl::BoundingBox &bounds);
+            void refit(void);
+
+            // Frustum Query - Appends Indices of Potentially Visible Instances
+            void cullFrustum(const sgl::Frustum &frustum, std::vector<unsigned int> &visible) const;
+
+            // Ray Query - Nearest Instance Whose Bounding Box is Hit, Optionally Refined by A Per-Instance Intersection Test Returning False on A Miss
+            bool raycast(const glm::vec3 &origin, const glm::vec3 &direction, sgl::RayHit &hit) const;
+            bool raycast(const glm::vec3 &origin, const glm::vec3 &direction, sgl::RayHit &hit, const std::function<bool(const unsigned int &instance, float &distance)> &intersect) const;
+
+            // Getters
+            std::size_t getNodeCount(void) const;
+            std::size_t getInstanceCount(void) const;
+        private:
+            // Flat Node Array - Children Are Always Stored After Their Parent
+            std::vector<sgl::BVHNode> nodes;
+
+            // Instance Bounding Boxes and Instance Indices Referenced by Leaf Nodes
+            std::vector<sgl::BoundingBox> instanceBounds;
+            std::vector<unsigned int> instanceIndices;
+
+            // Recompute A Node's Bounds From Its Instances
+            void updateNodeBounds(sgl::BVHNode &node);
     };
 
     // Model
@@ -131,6 +434,86 @@ namespace sgl {
         glm::vec3 position, normalVector;
         glm::vec2 textureCoords;
     };
+
+    // Compact Vertex - 16-Bit Normalized Position (Dequantized With Per-Mesh Offset/Scale), Octahedral Encoded 2x16-Bit Normal Vector and Half-Float Texture Coordinates
+    enum VertexFormat {Float32, Compact};
+    struct CompactVertexStruct {
+        GLushort position[4];
+        GLshort normalVector[2];
+        GLhalf textureCoords[2];
+    };
+
+    // Model Bake Settings - Chosen When Importing A Model
+    struct ModelBakeSettings {
+        // Job System Meshes Are Baked on - Without One bakeThreads Dedicated Threads Are Started
+        sgl::JobSystem* jobSystem {nullptr};
+
+        // Vertex Format - Compact Meshes Whose Quantization Error Exceeds Any of The Maximum Errors Fall Back to Float32
+        sgl::VertexFormat vertexFormat {sgl::VertexFormat::Float32};
+        float maxPositionError {0.001f}, maxNormalErrorDegrees {1.0f}, maxTexCoordError {0.001f};
+
+        // Split Meshes With More Than 65536 Vertices So Every Mesh Can Use 16-Bit Indices
+        bool splitFor16BitIndices {false};
+
+        // Split The Full Detail Level Into Meshlets For Cluster Culling - Reorders Its Triangles So Every Meshlet is Contiguous
+        bool buildMeshlets {false};
+
+        // Level of Detail - Extra Levels Simplified by Quadric Error Edge Collapse, Each Keeping lodTriangleRatio of The Previous Level's Triangles
+        // Normal/Texture Coordinate Differences Across A Collapsed Edge Add to Its Error, Weighted Relative to The Mesh Size
+        unsigned int lodLevels {0};
+        float lodTriangleRatio {0.5f}, lodAttributeWeight {0.01f};
+
+        // Keep CPU-Side Vertices and Indices After Uploading Them to The GPU
+        bool keepCPUData {true};
+
+        // Number of Threads Meshes Are Converted and Baked on - 0 Uses All Hardware Threads
+        unsigned int bakeThreads {0};
+
+        // Defer VAO Creation Until Model::createVertexArrays - VAOs Aren't Shared Between OpenGL Contexts
+        bool deferVertexArrays {false};
+    };
+
+    // Level of Detail - Range of The Mesh Index Buffer and Its Geometric Error in Model Space Units, Level 0 is The Full Mesh
+    struct LODLevel {
+        GLuint firstIndex {0};
+        GLsizei indexCount {0};
+        float error {0.0f};
+    };
+
+    // CPU-Side Mesh Data - Baked on Worker Threads and Uploaded to The GPU on The Render Context Thread
+    struct MeshData {
+        std::vector<VertexStruct> vertices;
+        std::vector<GLuint> indices;
+
+        // Bounding Volumes - Computed When Baking
+        sgl::BoundingBox boundingBox;
+        sgl::BoundingSphere boundingSphere;
+
+        // Level of Detail Chain - Every Level's Indices Are Appended to indices and Share The Same Vertices
+        std::vector<sgl::LODLevel> lodLevels;
+
+        // Meshlets of The Full Detail Level - Empty Unless Built When Baking
+        std::vector<sgl::Meshlet> meshlets;
+
+        // Compact Vertices - Empty Unless The Mesh Was Baked in The Compact Vertex Format Within The Error Bounds
+        std::vector<CompactVertexStruct> compactVertices;
+        glm::vec3 dequantOffset {0.0f}, dequantScale {1.0f};
+    };
+
+    // Bake CPU-Side Mesh Data - Thread-Safe, Doesn't Touch OpenGL
+    void bakeMeshData(sgl::MeshData &meshData, const sgl::ModelBakeSettings &bakeSettings);
+
+    // Generate The Level of Detail Chain of Baked Mesh Data - Thread-Safe, Called by bakeMeshData
+    void generateLODs(sgl::MeshData &meshData, const sgl::ModelBakeSettings &bakeSettings);
+
+    // Split The Full Detail Level of Baked Mesh Data Into Meshlets - Thread-Safe, Called by bakeMeshData
+    void buildMeshlets(sgl::MeshData &meshData);
+
+    // Render Queue and Command Buffer - Defined After The Model
+    enum RenderPass {Opaque, Transparent};
+    class RenderQueue;
+    class CommandBuffer;
+
     struct TextureStruct {
         GLuint id;
         std::string type, path;
@@ -143,45 +526,839 @@ namespace sgl {
             std::vector<TextureStruct> textures;
 
             // Constructor - Create A Mesh Object
-            Mesh(const std::vector<VertexStruct> &vertices, const std::vector<GLuint> &indices, const std::vector<TextureStruct> &textures);
+            Mesh(std::vector<VertexStruct> vertices, std::vector<GLuint> indices, std::vector<TextureStruct> textures);
+            Mesh(std::vector<VertexStruct> vertices, std::vector<GLuint> indices, std::vector<TextureStruct> textures, const sgl::ModelBakeSettings &bakeSettings);
+            Mesh(sgl::MeshData meshData, std::vector<TextureStruct> textures, const sgl::ModelBakeSettings &bakeSettings);
 
             // Render Mesh Object
             void render(sgl::Shader &shader);
 
+            // Render Only The Meshlets Inside The Frustum and Facing The Camera - Falls Back to render Without Meshlets or Below Full Detail
+            void render(sgl::Shader &shader, const sgl::Frustum &frustum, const glm::vec3 &cameraPosition, sgl::CullStats &cullStats);
+
+            // Bind Mesh Textures, Vertex Decoding Uniforms and VAO For Drawing - Caller Issues The Draw and Unbinds The VAO
+            void bind(sgl::Shader &shader);
+            void bindTextures(sgl::Shader &shader);
+            void bindVertexArray(sgl::Shader &shader);
+
+            // Prepare The Index Ranges The Next draw Issues - The Current Level of Detail, or Only The Visible Meshlets of The Full Detail Level
+            // Returns False When Every Meshlet Was Culled
+            bool prepareDraw(void);
+            bool prepareDraw(const sgl::Frustum &frustum, const glm::vec3 &cameraPosition, sgl::CullStats &cullStats);
+
+            // Draw The Prepared Index Ranges - The Mesh Must Be Bound
+            void draw(void);
+
+            // Draw Index Ranges Captured Earlier With getDrawCounts/getDrawOffsets - The Mesh Must Be Bound
+            void draw(const GLsizei* counts, void* const* offsets, const GLsizei &rangeCount);
+
             // Destroy Mesh
             void destroy(void);
+
+            // Release CPU-Side Vertices and Indices - GPU Buffers Stay Intact
+            void releaseCPUData(void);
+
+            // Create VAO on The Current OpenGL Context - Done on Upload Unless Deferred
+            void createVertexArray(void);
+
+            // Select The Coarsest Level of Detail Whose Projected Error Stays Under maxPixelError - projectionScale is Viewport Height / (2 * tan(FOV / 2))
+            void selectLOD(const glm::vec3 &viewPosition, const float &projectionScale, const float &maxPixelError);
+
+            // Getters
+            sgl::VertexFormat getVertexFormat(void);
+            GLenum getIndexType(void);
+            GLsizei getIndexCount(void);
+            const std::vector<sgl::LODLevel>& getLODLevels(void);
+            const std::vector<sgl::Meshlet>& getMeshlets(void);
+            unsigned int getCurrentLOD(void);
+            const std::vector<GLsizei>& getDrawCounts(void);
+            const std::vector<void*>& getDrawOffsets(void);
+            GLuint getVertexArray(void);
+            GLuint getMaterialID(void);
+            const sgl::BoundingBox& getBoundingBox(void);
+            const sgl::BoundingSphere& getBoundingSphere(void);
         private:
             // Render Data
-            GLuint VAO, VBO, IBO;
+            GLuint VAO {0}, VBO {0}, IBO {0};
+
+            // Index Type - GL_UNSIGNED_SHORT When The Mesh Has At Most 65536 Vertices
+            GLenum indexType {GL_UNSIGNED_INT};
+            GLsizei indexCount {0};
+
+            // Level of Detail Chain and The Level Currently Rendered
+            std::vector<sgl::LODLevel> lodLevels;
+            unsigned int currentLOD {0};
+
+            // Meshlets and Their Culling Bounds
+            std::vector<sgl::Meshlet> meshlets;
+            sgl::MeshletBoundsList meshletBounds;
+            std::vector<unsigned int> visibleMeshlets;
+
+            // Prepared Draw Ranges - Visible Meshlets Adjacent in The Index Buffer Are Merged
+            std::vector<GLsizei> drawCounts;
+            std::vector<void*> drawOffsets;
+
+            // Bounding Volumes
+            sgl::BoundingBox boundingBox;
+            sgl::BoundingSphere boundingSphere;
+
+            // Vertex Format and Position Dequantization - Identity For Float32 Meshes
+            sgl::VertexFormat vertexFormat {sgl::VertexFormat::Float32};
+            glm::vec3 dequantOffset {0.0f}, dequantScale {1.0f};
+
+            // Upload Baked Mesh Data to The GPU
+            void upload(sgl::MeshData meshData, std::vector<TextureStruct> textures, const sgl::ModelBakeSettings &bakeSettings);
     };
     class Model {
         public:
             // Constructor - Load Model File
             Model(const std::string &modelFilePath, const unsigned int &processFlags);
+            Model(const std::string &modelFilePath, const unsigned int &processFlags, const sgl::ModelBakeSettings &bakeSettings);
 
             // Render Model
             void render(sgl::Shader &shader);
 
+            // Render Only The Meshes Inside The Frustum - The Frustum Must Be Built From The Model's Projection * View * Model Matrix
+            void render(sgl::Shader &shader, const sgl::Frustum &frustum, sgl::CullStats &cullStats);
+
+            // Render Visible Meshes and Cull Their Meshlets Too - The Camera Position Must Be in Model Space
+            void render(sgl::Shader &shader, const sgl::Frustum &frustum, const glm::vec3 &cameraPosition, sgl::CullStats &cullStats);
+
+            // Record Draws of The Visible Meshes in [firstMesh, firstMesh + meshCount) Into A Command Buffer - Thread-Safe For Disjoint Mesh Ranges
+            void record(sgl::CommandBuffer &commandBuffer, sgl::Shader &shader, const glm::mat4 &projectionViewMatrix, const glm::mat4 &modelMatrix, const glm::vec3 &cameraPosition, const std::size_t &firstMesh, const std::size_t &meshCount, sgl::CullStats &cullStats);
+
+            // Record All The Meshes Split Into One Chunk Per Command Buffer as Parallel Jobs - Replay The Buffers in Order Afterwards
+            void recordParallel(sgl::JobSystem &jobSystem, std::vector<sgl::CommandBuffer> &commandBuffers, sgl::Shader &shader, const glm::mat4 &projectionViewMatrix, const glm::mat4 &modelMatrix, const glm::vec3 &cameraPosition, sgl::CullStats &cullStats);
+
+            // Submit Visible Meshes to A Render Queue Instead of Drawing Them Immediately - The Camera Position Must Be in World Space
+            void submit(sgl::RenderQueue &renderQueue, const sgl::RenderPass &pass, sgl::Shader &shader, const glm::mat4 &projectionViewMatrix, const glm::mat4 &modelMatrix, const glm::vec3 &cameraPosition, sgl::CullStats &cullStats);
+
+            // Submit With Meshlet Culling Spread Over Jobs - Items Are Still Queued in Mesh Order on The Calling Thread
+            void submit(sgl::JobSystem &jobSystem, sgl::RenderQueue &renderQueue, const sgl::RenderPass &pass, sgl::Shader &shader, const glm::mat4 &projectionViewMatrix, const glm::mat4 &modelMatrix, const glm::vec3 &cameraPosition, sgl::CullStats &cullStats);
+
+            // Ray Query in Model Space - Picks The Nearest Mesh, Triangle Accurate if CPU-Side Mesh Data Was Kept
+            bool raycast(const glm::vec3 &origin, const glm::vec3 &direction, sgl::RayHit &hit);
+
+            // Select Every Mesh's Level of Detail From Its Projected Screen-Space Error - The Camera Position Must Be in Model Space
+            void selectLODs(const glm::vec3 &cameraPosition, const float &fovDegrees, const float &viewportHeight, const float &maxPixelError);
+
+            // Create Deferred VAOs For All The Meshes on The Current OpenGL Context
+            void createVertexArrays(void);
+
+            // Getters
+            std::vector<sgl::Mesh>& getMeshes(void);
+
             // Destroy Model - Destroys All The Meshes
             void destroy(void);
         private:
             // Full Path to Model File
             std::string directory;
 
+            // Bake Settings
+            sgl::ModelBakeSettings bakeSettings;
+
             // Meshes
             std::vector<sgl::Mesh> meshes;
 
+            // Mesh Bounding Boxes and Visible Meshes of The Last Culled Render
+            sgl::BoundingBoxList meshBounds;
+            std::vector<unsigned int> visibleMeshes;
+
+            // Mesh BVH - Used For Picking and For Culling Models With Many Meshes
+            sgl::SceneBVH meshBVH;
+
+            // Cull Mesh Bounding Boxes Against The Frustum Into visibleMeshes
+            void cullMeshes(const sgl::Frustum &frustum, sgl::CullStats &cullStats);
+
             // Loaded Textures
             std::vector<sgl::TextureStruct> loadedTextures;
 
-            // Process All The Nodes/Meshes in The Model
-            void processNode(aiNode* node, const aiScene* scene);
-            sgl::Mesh processMesh(aiMesh* mesh, const aiScene* scene);
+            // Process All The Nodes/Meshes in The Model - Meshes Are Baked on Worker Threads Then Uploaded in One Batch
+            void processNode(aiNode* node, const aiScene* scene, std::vector<aiMesh*> &workList);
+            void processMesh(aiMesh* mesh, std::vector<sgl::MeshData> &meshData);
+            void uploadMeshes(const aiScene* scene, const std::vector<aiMesh*> &workList, std::vector<std::vector<sgl::MeshData>> &meshData);
 
             // Process All The Model's Materials/Textures
             std::vector<sgl::TextureStruct> loadMaterialTextures(aiMaterial* material, aiTextureType texType, const std::string &texTypeName);
     };
 
+    // Render Queue - Submissions Are Encoded as 64-Bit Sort Keys, Radix Sorted and Executed With Redundant State Changes Skipped
+    // Opaque Keys Sort by Shader, Material, VAO Then Front to Back Depth - Transparent Keys Sort Back to Front First
+    struct RenderStateChanges {
+        unsigned int shaderChanges {0}, materialChanges {0}, vertexArrayChanges {0};
+    };
+    struct RenderQueueStats {
+        unsigned int drawCalls {0};
+
+        // State Changes in Submission Order and After Sorting
+        sgl::RenderStateChanges unsorted, sorted;
+    };
+    struct RenderQueueItem {
+        sgl::Mesh* mesh;
+        sgl::Shader* shader;
+        glm::mat4 pvm;
+        sgl::RenderPass pass;
+        std::uint32_t firstRange, rangeCount;
+    };
+    class RenderQueue {
+        public:
+            // Submit A Prepared Mesh - pvm is Sent to The Shader's pvm Uniform, Depth is The View Distance Used For Ordering
+            // The Prepared Draw Ranges Are Copied, So The Mesh Can Be Prepared Again Before The Queue is Executed
+            void submit(const sgl::RenderPass &pass, sgl::Mesh &mesh, sgl::Shader &shader, const glm::mat4 &pvm, const float &depth);
+
+            // Sort and Execute All Submissions, Then Clear The Queue
+            void execute(void);
+
+            // Getters
+            const sgl::RenderQueueStats& getStats(void);
+        private:
+            // Submissions and Their Sort Keys - Keys Carry The Submission Index in A Parallel Array While Sorting
+            std::vector<sgl::RenderQueueItem> items;
+            std::vector<std::uint64_t> keys, sortedKeys;
+            std::vector<std::uint32_t> order, sortedOrder;
+
+            // Draw Ranges Copied From The Submitted Meshes
+            std::vector<GLsizei> drawCounts;
+            std::vector<void*> drawOffsets;
+
+            // Stats of The Last Executed Frame
+            sgl::RenderQueueStats stats;
+
+            // Count State Changes of Executing The Items in The Given Order
+            sgl::RenderStateChanges countStateChanges(const std::vector<std::uint32_t> &itemOrder);
+    };
+
+    // Command Buffer - Compact POD Commands Recorded Into A Linear Arena Without Touching OpenGL, Replayed on The OpenGL Thread
+    // Recorded Shaders/Meshes Must Stay Alive Until The Buffer is Executed, Draws Copy The Mesh's Prepared Ranges
+    class CommandBuffer {
+        public:
+            // Record Commands
+            void useShader(sgl::Shader &shader);
+            void bindTextures(sgl::Mesh &mesh, sgl::Shader &shader);
+            void bindVertexArray(sgl::Mesh &mesh, sgl::Shader &shader);
+            void setMat4(sgl::Shader &shader, const char* uniformVarName, const glm::mat4 &value);
+            void draw(sgl::Mesh &mesh);
+
+            // Replay All Recorded Commands on The Current OpenGL Context
+            void execute(void);
+
+            // Drop All Recorded Commands - The Arena Keeps Its Memory For The Next Frame
+            void reset(void);
+
+            // Getters
+            std::size_t getCommandCount(void);
+            std::size_t getSize(void);
+        private:
+            // Linear Arena - Each Command is A Type Byte Followed by Its Payload
+            std::vector<std::byte> arena;
+            std::size_t commandCount {0};
+
+            // Draw Ranges Unpacked From The Arena While Replaying
+            std::vector<GLsizei> replayCounts;
+            std::vector<void*> replayOffsets;
+
+            // Append A Command
+            template<typename Payload> void push(const std::uint8_t &type, const Payload &payload);
+    };
+
+    // Model Handle - Future-Like Handle to A Model Being Loaded in The Background by A Model Loader
+    struct ModelLoadRequest;
+    class ModelHandle {
+        public:
+            // Check if The Model is Resident - Polls The Upload Fence and Finalizes The Model on The Calling (Render) Thread Once Signaled
+            bool isResident(void);
+
+            // Get Loaded Model - Only Valid Once Resident
+            sgl::Model& get(void);
+        private:
+            friend class ModelLoader;
+            std::shared_ptr<sgl::ModelLoadRequest> request;
+    };
+
+    // Model Loader - Imports Models, Decodes Textures and Uploads Buffers on A Background Thread With A Shared OpenGL Context
+    class ModelLoader {
+        public:
+            // Constructor - Create A Hidden Window Sharing The Main Window's OpenGL Context and Start The Loader Thread
+            ModelLoader(GLFWwindow* sharedWin);
+
+            // Queue A Model to Be Loaded in The Background
+            sgl::ModelHandle load(const std::string &modelFilePath, const unsigned int &processFlags, const sgl::ModelBakeSettings &bakeSettings);
+
+            // Destroy Model Loader - Stops The Loader Thread and Destroys The Hidden Window, Must Be Called on The Main Thread
+            void destroy(void);
+        private:
+            // Hidden Window Owning The Loader's OpenGL Context
+            GLFWwindow* loaderWin {nullptr};
+
+            // Loader Thread and Request Queue
+            std::thread loaderThread;
+            std::mutex queueMutex;
+            std::condition_variable queueCondition;
+            std::deque<std::shared_ptr<sgl::ModelLoadRequest>> queue;
+            bool stopping {false};
+
+            // Loader Thread Main Loop
+            void loaderMain(void);
+    };
+
+    // Hierarchical-Z Depth Pyramid - Max Depth Mip Chain Built From A Depth Texture in A Compute Shader
+    class HiZPyramid {
+        public:
+            // Constructor - Load Pyramid Build Compute Shader and Allocate The Mip Chain
+            HiZPyramid(const std::string &computeShaderFilePath, const unsigned int &width, const unsigned int &height);
+
+            // Build Pyramid From A Non-Multisampled Depth Texture Framebuffer or Render Target
+            void build(sgl::Framebuffer &depthFramebuffer);
+            void build(sgl::RenderTarget &depthTarget);
+
+            // Resize - Reallocates The Mip Chain, Does Nothing if The Size is Unchanged
+            void resize(const unsigned int &width, const unsigned int &height);
+
+            // Bind Pyramid Texture to The Active Texture Unit
+            void bind(void);
+
+            // Getters
+            glm::vec2 getSize(void);
+            unsigned int getMipCount(void);
+
+            // Destroy Pyramid
+            void destroy(void);
+        private:
+            // Pyramid Build Compute Shader
+            sgl::Shader buildShader;
+
+            // Pyramid Texture and Dimensions
+            GLuint texture {0};
+            unsigned int width, height, mipCount;
+
+            // Allocate The Mip Chain/Build From The Depth Texture Bound to Texture Unit 0
+            void allocate(void);
+            void buildFromBoundDepth(void);
+    };
+
+    // GPU Culler - Culls Instances of A Mesh Against The Frustum in A Compute Shader and Draws The Survivors With Multi-Draw Indirect
+    struct DrawElementsIndirectCommand {
+        GLuint count, instanceCount, firstIndex;
+        GLint baseVertex;
+        GLuint baseInstance;
+    };
+    enum CullPhase {FrustumOnly, LastFrameVisible, OcclusionRetest};
+    class GPUCuller {
+        public:
+            // Constructor - Load Culling Compute Shader and Create Buffers
+            GPUCuller(const std::string &computeShaderFilePath);
+
+            // Upload Instance Model Matrices
+            void setInstances(const std::vector<glm::mat4> &modelMatrices);
+
+            // Cull Instances of A Mesh - Writes Compacted Draw Commands and The Draw Count on The GPU
+            void cull(sgl::Mesh &mesh, const glm::mat4 &projectionViewMatrix);
+
+            // Two-Phase Occlusion Culling - LastFrameVisible Draws Instances Visible Last Frame, Then After The Hi-Z Pyramid is Rebuilt
+            // From That Depth OcclusionRetest Draws Newly Visible Instances and Records Visibility For The Next Frame
+            void cull(sgl::Mesh &mesh, const glm::mat4 &projectionViewMatrix, const sgl::CullPhase &phase, sgl::HiZPyramid &hiZPyramid);
+
+            // Render Visible Instances of The Last Culling Phase - The Shader Reads The Model Matrix of instanceIndex (Location 3) From Binding 0
+            void render(sgl::Mesh &mesh, sgl::Shader &shader);
+
+            // Destroy GPU Culler
+            void destroy(void);
+        private:
+            // Culling Compute Shader
+            sgl::Shader cullShader;
+
+            // Instance Matrices, Instance Index Attribute and Last Frame Visibility Buffers
+            GLuint instanceBuffer {0}, instanceIndexBuffer {0}, visibilityBuffer {0};
+            unsigned int instanceCount {0};
+
+            // Draw Commands and Draw Count Buffers - One Set Per Occlusion Phase So Phase 2 Doesn't Overwrite Phase 1 Draws
+            GLuint commandBuffers[2] {0, 0}, drawCountBuffers[2] {0, 0};
+            unsigned int currentBuffers {0};
+
+            // Shared Culling Dispatch - The Pyramid is Null For Frustum Only Culling
+            void dispatchCull(sgl::Mesh &mesh, const glm::mat4 &projectionViewMatrix, const sgl::CullPhase &phase, sgl::HiZPyramid* hiZPyramid);
+
+            // Whether glMultiDrawElementsIndirectCount is Available - Otherwise Culled Commands Are Zeroed in Place
+            bool indirectCountSupported {false};
+    };
+
+    // Trace Event - One Finished Scope, Times in Nanoseconds Since The Trace Started
+    // Names Must Outlive The Trace - String Literals or Names From internTraceName
+    struct TraceEvent {
+        const char* name;
+        std::uint64_t start, duration;
+    };
+
+    // Trace Buffer - Ring of The Newest Events of One Thread, Only That Thread Writes and Publishes Them by Advancing head
+    struct TraceBuffer {
+        static const std::size_t capacity {1 << 16};
+        std::unique_ptr<sgl::TraceEvent[]> events {std::make_unique<sgl::TraceEvent[]>(capacity)};
+        std::atomic<std::uint64_t> head {0};
+        std::uint32_t threadID {0};
+        std::string threadName;
+    };
+
+    // Tracing - Scopes Are Only Recorded While Enabled, Disabled Scopes Cost One Relaxed Load
+    void setTracingEnabled(const bool &enabled);
+    bool isTracingEnabled(void);
+
+    // Nanoseconds Since The Trace Started
+    std::uint64_t getTraceTime(void);
+
+    // Record A Finished Scope on The Calling Thread's Buffer, Created and Registered on Its First Event
+    void recordTraceEvent(const char* name, const std::uint64_t &start, const std::uint64_t &duration);
+
+    // Record A Scope on The GPU Timeline - Only Called From The Thread Resolving GPU Timings
+    void recordGPUTraceEvent(const char* name, const std::uint64_t &start, const std::uint64_t &duration);
+
+    // Name The Calling Thread in The Trace
+    void setTraceThreadName(const std::string &name);
+
+    // Copy A Name Into Storage That Lives as Long as The Program - The Same Name Always Returns The Same Pointer
+    const char* internTraceName(const std::string &name);
+
+    // Write The Newest Events of Every Thread as Chrome Trace Event JSON (Loadable in Perfetto or chrome://tracing)
+    bool exportChromeTrace(const std::string &filePath);
+
+    // Trace Scope - Records The Time Between Its Construction and Destruction
+    class TraceScope {
+        public:
+            TraceScope(const char* name);
+            ~TraceScope(void);
+        private:
+            const char* name {nullptr};
+            std::uint64_t start {0};
+    };
+
+    // Profile The Rest of The Enclosing Block - Define SGL_DISABLE_PROFILING to Compile Scopes Out Entirely
+    #define SGL_PROFILE_CONCAT_IMPL(a, b) a##b
+    #define SGL_PROFILE_CONCAT(a, b) SGL_PROFILE_CONCAT_IMPL(a, b)
+    #ifdef SGL_DISABLE_PROFILING
+    #define SGL_PROFILE_SCOPE(name) ((void)0)
+    #else
+    #define SGL_PROFILE_SCOPE(name) sgl::TraceScope SGL_PROFILE_CONCAT(sglTraceScope, __LINE__) {name}
+    #endif
+
+    // Stat Counters - Counted on Whichever Thread Issues The Work
+    enum StatCounter {DrawCallCount, TriangleCount, StateChangeCount, UniformUploadCount, TextureBindCount, BufferUploadBytes, StatCounterCount};
+
+    // Stats Thread Counters - One Set Per Thread So Counting Never Contends, Merged and Reset Once Per Frame
+    struct StatsThreadCounters {
+        std::atomic<std::uint64_t> values[sgl::StatCounterCount] {};
+    };
+
+    // Frame Stats - Merged Counters of One Frame, Times in Milliseconds Are Filled in by The Caller
+    // Render CPU Time Covers Only The Render Stage Submitting The Frame, Not Sampling or Updating It
+    struct FrameStats {
+        std::uint64_t counters[sgl::StatCounterCount] {};
+        double renderCPUTime {0.0}, gpuFrameTime {0.0};
+    };
+
+    // Stats - Counters Are Only Updated While Enabled, Disabled Counting Costs One Relaxed Load
+    void setStatsEnabled(const bool &enabled);
+    bool isStatsEnabled(void);
+
+    // Add to A Counter of The Calling Thread, Registered on Its First Count
+    void addStat(const sgl::StatCounter &counter, const std::uint64_t &value);
+
+    // Merge and Reset Every Thread's Counters - Call Once Per Frame
+    sgl::FrameStats collectStats(void);
+
+    // Format Frame Stats as Lines of Text
+    std::string formatStats(const sgl::FrameStats &stats);
+
+    // Count Work - Define SGL_DISABLE_PROFILING to Compile Counting Out Entirely
+    #ifdef SGL_DISABLE_PROFILING
+    #define SGL_STAT_ADD(counter, value) ((void)0)
+    #else
+    #define SGL_STAT_ADD(counter, value) sgl::addStat(counter, value)
+    #endif
+
+    // Stats Overlay - Text Quads Generated by stb_easy_font, Uploaded and Drawn in One Batched Draw
+    class StatsOverlay {
+        public:
+            // Constructor - Load Overlay Shaders and Create Buffers
+            StatsOverlay(const std::string &vertexShaderFilePath, const std::string &fragmentShaderFilePath);
+
+            // Draw Text With A Drop Shadow Into The Bound Framebuffer - Position is in Pixels From The Top Left, The Font is 7 Pixels Tall Before Scaling
+            void draw(const std::string &text, const glm::vec2 &position, const float &scale, const glm::ivec2 &viewportSize);
+
+            // Destroy Stats Overlay
+            void destroy(void);
+        private:
+            // Overlay Shaders
+            sgl::Shader shader;
+
+            // Quad Vertices Written by stb_easy_font and The Shared Quad Index Buffer
+            GLuint VAO {0}, VBO {0}, IBO {0};
+            std::vector<char> text, vertices;
+            std::size_t quadCapacity {0};
+    };
+
+    // GPU Pass Timing - Last Resolved and Rolling Average GPU/CPU Times of A Named Pass in Milliseconds
+    struct GPUPassTiming {
+        std::string name;
+        double gpuTime {0.0}, cpuTime {0.0};
+        double averageGPUTime {0.0}, averageCPUTime {0.0};
+    };
+
+    // GPU Profiler Scope - Two Timestamp Queries and The CPU Time of One Pass in A Frame
+    struct GPUProfilerScope {
+        unsigned int pass;
+        GLuint beginQuery, endQuery;
+        double cpuTime;
+    };
+
+    // GPU Profiler Frame - Scopes Recorded in One Frame, Query Objects Are Kept and Reused
+    // The Last Issued Query Completes After All Others, Scopes Nest So It Isn't The Last One Taken From The Pool
+    struct GPUProfilerFrame {
+        std::uint64_t frameIndex {0};
+        std::vector<GLuint> queries;
+        std::size_t queryCount {0};
+        GLuint lastIssuedQuery {0};
+        std::vector<sgl::GPUProfilerScope> scopes;
+    };
+
+    // GPU Profiler Record - One Resolved Pass in One Frame
+    struct GPUProfilerRecord {
+        std::uint64_t frameIndex;
+        unsigned int pass;
+        double gpuTime, cpuTime;
+    };
+
+    // GPU Profiler - Timestamp Queries Around Each Pass, Read Back Several Frames Later So The CPU Never Waits on The GPU
+    // Passes Can Nest, CPU Time is The Time Spent Submitting Between beginPass and endPass
+    // While Tracing, Passes Are Also Recorded as Trace Events on The CPU and GPU Timelines
+    class GPUProfiler {
+        public:
+            // Constructor - Results Are Read frameLatency Frames After They Were Recorded
+            GPUProfiler(const unsigned int &frameLatency);
+
+            // Frame Boundaries - beginFrame Resolves The Oldest Frame in The Ring, Returns False if It Was Dropped or Empty and The Timings Are Still Last Time's
+            bool beginFrame(void);
+            void endFrame(void);
+
+            // Pass Scopes
+            void beginPass(const std::string &name);
+            void endPass(void);
+
+            // Write Every Resolved Frame as CSV Rows of Frame, Pass, GPU and CPU Milliseconds
+            bool exportCSV(const std::string &filePath);
+
+            // Getters
+            const std::vector<sgl::GPUPassTiming>& getPasses(void);
+            const sgl::GPUPassTiming* getPass(const std::string &name);
+            bool isGPUTimingAvailable(void);
+            std::uint64_t getDroppedFrames(void);
+
+            // Destroy GPU Profiler
+            void destroy(void);
+        private:
+            // Frames in The Ring
+            std::vector<sgl::GPUProfilerFrame> frames;
+            std::uint64_t frameIndex {0};
+
+            // Open Scopes - Scope Index and CPU Start Trace Time
+            std::vector<std::pair<std::size_t, std::uint64_t>> openScopes;
+
+            // Passes, Their Interned Trace Names and Resolved Per Frame Rows
+            std::vector<sgl::GPUPassTiming> passes;
+            std::vector<const char*> passTraceNames;
+            std::vector<sgl::GPUProfilerRecord> history;
+
+            // Timestamp Support - No Counter Bits Means CPU Timing Only, Fewer Than 64 Bits Wrap Around
+            bool gpuTimingAvailable {false};
+            std::uint64_t timestampMask {0};
+            std::uint64_t droppedFrames {0};
+
+            // GPU Timestamp Minus Trace Time, Measured Once - Only Full 64-Bit Timestamps Are Placed on The Trace's GPU Timeline
+            std::int64_t gpuClockOffset {0};
+            bool gpuClockCalibrated {false};
+
+            // Read Back A Frame's Queries if They're Ready - Returns Whether The Pass Timings Were Updated
+            bool resolve(sgl::GPUProfilerFrame &frame);
+    };
+
+    // Render Graph Resource Usage - How A Pass Accesses A Resource, Decides The Memory Barriers Before It
+    enum RenderGraphUsage {ColorAttachment, DepthAttachment, SampledTexture, StorageImage, BlitSource, BlitDestination};
+
+    // Render Graph Resource - Handle of A Virtual Resource Declared This Frame
+    typedef unsigned int RenderGraphResource;
+    struct RenderGraphAccess {
+        sgl::RenderGraphResource resource;
+        sgl::RenderGraphUsage usage;
+    };
+
+    // Render Graph Resource Node - Transient Resources Get A Pooled Target For The Passes Between Their First and Last Use (Positions in The Sorted Order)
+    struct RenderGraphResourceNode {
+        std::string name;
+        sgl::RenderTargetDesc desc;
+        sgl::RenderTarget* target {nullptr};
+        bool imported {false};
+        int firstPass {-1}, lastPass {-1};
+    };
+
+    // Render Graph Pass - Runs Once Its Memory Barriers Are Issued, Culled When Nothing Needed Reads What It Writes
+    class RenderGraph;
+    struct RenderGraphPass {
+        std::string name;
+        std::vector<sgl::RenderGraphAccess> reads, writes;
+        std::function<void(sgl::RenderGraph&)> execute;
+        bool sideEffects {false}, culled {false};
+        GLbitfield barrierBits {0};
+    };
+
+    // Render Graph Stats - Of The Last Compiled and Executed Graph
+    struct RenderGraphStats {
+        unsigned int passes {0}, culledPasses {0};
+        unsigned int transientResources {0}, physicalTargets {0};
+        unsigned int barriers {0};
+    };
+
+    // Render Graph - Passes Declare The Virtual Resources They Read and Write, Then The Graph is Compiled and Executed Once
+    // Passes Run Sorted by Their Dependencies - A Read Sees The Last Write Declared Before It, or The First Write After It if A Transient Resource
+    // Hasn't Been Written Yet, Independent Passes Keep Declaration Order. Reading A Transient Nothing Writes or A Cycle Fails The Compile
+    // Transient Resources Are Acquired From The Render Target Pool Before Their First Use and Released After Their Last,
+    // So Resources With Matching Descriptors and Non-Overlapping Lifetimes Alias The Same Target
+    class RenderGraph {
+        public:
+            // Constructor - Transient Resources Come From The Pool
+            RenderGraph(sgl::RenderTargetPool &renderTargetPool);
+
+            // Declare A Transient Resource/Import A Target Owned Elsewhere (The Default Framebuffer or A Persistent Target)
+            // Writing An Imported Resource Keeps A Pass Alive
+            sgl::RenderGraphResource createResource(const std::string &name, const sgl::RenderTargetDesc &desc);
+            sgl::RenderGraphResource importResource(const std::string &name, sgl::RenderTarget &target);
+
+            // Add A Pass - Returns Its Index, Passes With Side Effects Outside The Graph (Readbacks, Persistent State) Are Never Culled
+            unsigned int addPass(const std::string &name, const std::vector<sgl::RenderGraphAccess> &reads, const std::vector<sgl::RenderGraphAccess> &writes, const std::function<void(sgl::RenderGraph&)> &execute);
+            void setSideEffects(const unsigned int &pass);
+
+            // Sort The Passes, Cull Unused Ones and Compute Resource Lifetimes
+            void compile(void);
+
+            // Run The Live Passes With The Memory Barriers Their Targets Need - Each is Timed as A Pass of The Profiler Unless It's Null
+            // Nothing Runs if The Compile Failed
+            void execute(sgl::GPUProfiler* profiler);
+
+            // Drop All Passes and Resources For The Next Frame
+            void reset(void);
+
+            // Getters - Targets Are Only Valid While The Passes Using Them Execute
+            sgl::RenderTarget* getTarget(const sgl::RenderGraphResource &resource);
+            const sgl::RenderTargetDesc& getDesc(const sgl::RenderGraphResource &resource);
+            const sgl::RenderGraphStats& getStats(void);
+        private:
+            sgl::RenderTargetPool* renderTargetPool;
+
+            // Passes, Their Sorted Execution Order and Resources of This Frame
+            std::vector<sgl::RenderGraphPass> passes;
+            std::vector<unsigned int> order;
+            std::vector<sgl::RenderGraphResourceNode> resources;
+            sgl::RenderGraphStats stats;
+            bool compiled {false}, valid {false};
+    };
+
+    // Dynamic Resolution - Adjusts The Render Scale (Fraction of The Output Size The Scene Renders At) to Hold A Target GPU Frame Time
+    // GPU Time is Taken to Grow With Pixel Count, So The Scale Moves by The Square Root of The Budget Ratio
+    // Scales Are Quantized So Pooled Targets Are Reused Instead of Recreated For Every Small Change
+    class DynamicResolution {
+        public:
+            // Constructor - Frame Time in Milliseconds, A Change is Only Judged Once Its Frames Have Been Timed (The GPU Profiler's Latency)
+            DynamicResolution(const double &targetFrameTime, const float &minScale, const float &maxScale, const unsigned int &settleFrames);
+
+            // Feed A Newly Resolved GPU Frame Time, Once Per Readback - Returns The Scale to Render This Frame At, Unchanged While Disabled or Without Timings
+            float update(const double &gpuFrameTime);
+
+            // Setters - The Scale is Clamped to The Bounds
+            void setScale(const float &scale);
+            void setEnabled(const bool &enabled);
+
+            // Getters
+            float getScale(void);
+            bool isEnabled(void);
+
+            // Size Scaled by The Current Scale - At Least One Pixel
+            glm::uvec2 getScaledSize(const glm::ivec2 &size);
+        private:
+            double targetFrameTime;
+            float minScale, maxScale, scale;
+            unsigned int settleFrames, framesSinceChange {0};
+            double smoothedFrameTime {0.0};
+            bool enabled {true};
+    };
+
+    // Post Processing Effect - Per Pixel Effects Only Read The Pixel Being Shaded, FXAA and Sharpen Read Its Neighbors
+    // Blur and Bloom Run Their Own Passes, Bloom's Composite is Per Pixel and Fused Into The Pass After Them
+    enum PostProcessEffect {TonemapEffect, ColorGradeEffect, VignetteEffect, FXAAEffect, SharpenEffect, BlurEffect, BloomEffect, PostProcessEffectCount};
+
+    // Post Processing Backend - How Blur and Bloom Passes Run, Compute Passes Tile Separable Blurs Through Shared Memory
+    enum PostProcessBackend {FragmentBackend, ComputeBackend};
+
+    // Post Processing Settings - Parameters of Every Effect
+    struct PostProcessSettings {
+        float exposure {1.0f};
+        float colorGradeStrength {1.0f};
+        float vignetteIntensity {0.4f}, vignetteRadius {0.6f}, vignetteSoftness {0.5f};
+        float fxaaSpanMax {8.0f}, fxaaEdgeThreshold {0.125f}, fxaaEdgeThresholdMin {0.0312f};
+        float sharpenStrength {0.3f};
+
+        // Gaussian Radii in Texels, Up to 32
+        unsigned int blurRadius {8};
+        float bloomThreshold {0.8f}, bloomKnee {0.4f}, bloomIntensity {0.6f};
+        unsigned int bloomLevels {5}, bloomBlurRadius {4};
+    };
+
+    // Post Processing Stage - Fragment Stages Are One Full Screen Pass Running A Generated Shader
+    // The Input is Read by The Leading Neighborhood Effect if There is One, Upscaled or Fetched Otherwise, Then Every Fused Per Pixel Effect Follows
+    // Blur Stages Replace The Image, Bloom Stages Build The Bloom Texture The Next Fragment Stage Composites
+    enum PostProcessStageType {FragmentStage, BlurStage, BloomStage};
+    struct PostProcessStage {
+        sgl::PostProcessStageType type {sgl::PostProcessStageType::FragmentStage};
+        sgl::PostProcessBackend backend {sgl::PostProcessBackend::FragmentBackend};
+        std::vector<sgl::PostProcessEffect> effects;
+        bool upscale {false};
+        std::string name;
+        unsigned int program {0};
+    };
+
+    // Post Processing Chain - Runs Effects in Order, Fusing Per Pixel Effects Into The Pass Before Them
+    // Only Neighborhood Effects Start A New Pass, So The Pass Count Grows With Them and Not With The Total Effect Count
+    // Intermediate Results Ping-Pong Between Two Pooled Targets Through The Render Graph
+    class PostProcessChain {
+        public:
+            // Constructor - Effect Sources and The Full Screen Vertex Shader Are Read From The Shader Directory
+            PostProcessChain(const std::string &shaderDirectory);
+
+            // Setters - Passes Are Rebuilt When The Effects Change, Shaders Are Generated Once Per Combination and Kept
+            void setEffects(const std::vector<sgl::PostProcessEffect> &effects);
+            void setEffectBackend(const sgl::PostProcessEffect &effect, const sgl::PostProcessBackend &backend);
+            void setSettings(const sgl::PostProcessSettings &settings);
+
+            // Set The Color Grade 3D LUT Texture - 0 Restores The Identity LUT
+            void setColorGradeLUT(const GLuint &lut);
+
+            // Add The Chain's Passes to A Render Graph - The Input is Upscaled if It's Smaller Than The Output
+            void addPasses(sgl::RenderGraph &renderGraph, const sgl::RenderGraphResource &input, const glm::uvec2 &inputSize, const sgl::RenderGraphResource &output, const glm::uvec2 &outputSize);
+
+            // Getters
+            const std::vector<sgl::PostProcessEffect>& getEffects(void);
+            sgl::PostProcessBackend getEffectBackend(const sgl::PostProcessEffect &effect);
+            const sgl::PostProcessSettings& getSettings(void);
+            std::size_t getStageCount(void);
+
+            // Destroy Post Processing Chain
+            void destroy(void);
+        private:
+            std::string shaderDirectory;
+            std::vector<sgl::PostProcessEffect> effects;
+            sgl::PostProcessBackend effectBackends[sgl::PostProcessEffect::PostProcessEffectCount] {};
+            sgl::PostProcessSettings settings;
+
+            // Stages Built For The Current Effects, Whether The Input Was Upscaled and Whether The Output Can Be Written as An Image
+            std::vector<sgl::PostProcessStage> stages;
+            bool stagesUpscale {false}, stagesStorageOutput {false}, stagesBuilt {false};
+
+            // Generated and Blur/Bloom Shaders by Name
+            std::vector<std::pair<std::string, sgl::Shader>> programs;
+
+            // Empty Vertex Array For The Full Screen Triangle and LUTs
+            GLuint vertexArray {0}, identityLUT {0}, colorGradeLUT {0};
+
+            // Split The Effects Into Stages and Generate Their Shaders
+            void buildStages(const bool &upscale, const bool &storageOutput);
+            unsigned int getProgram(const sgl::PostProcessStage &stage);
+
+            // Load A Blur/Bloom Shader From The Shader Directory
+            unsigned int loadProgram(const std::string &fileName, const bool &compute);
+
+            // Add A Separable Blur as Horizontal and Vertical Passes, and The Bloom Downsample, Blur and Upsample Chain - Returns The Bloom Resource
+            void addBlurPasses(sgl::RenderGraph &renderGraph, const std::string &name, const sgl::RenderGraphResource &input, const sgl::RenderGraphResource &output, const glm::uvec2 &size, const GLenum &format, const unsigned int &radius, const sgl::PostProcessBackend &backend);
+            sgl::RenderGraphResource addBloomPasses(sgl::RenderGraph &renderGraph, const sgl::RenderGraphResource &input, const glm::uvec2 &size, const sgl::PostProcessBackend &backend);
+
+            // Run A Blur/Bloom Shader Reading Bound Textures Into A Target - Dispatched Over Its Pixels or Drawn as A Full Screen Triangle
+            void runPass(sgl::Shader &shader, sgl::RenderTarget &output, const sgl::PostProcessBackend &backend, const glm::uvec3 &groupCount);
+
+            // Draw A Stage Reading The Input Target (and The Bloom Target if It Composites Bloom) Into The Bound Framebuffer
+            void drawStage(const sgl::PostProcessStage &stage, sgl::RenderTarget &input, sgl::RenderTarget* bloom);
+            void drawFullScreenTriangle(void);
+    };
+
+    // Anti-Aliasing Mode - MSAA Multisamples The Scene and Resolves It, FXAA is The Post Processing Chain's FXAA Effect
+    // SMAA 1x Finds Edges, Estimates How Much of Each Edge Pixel The Shape Across It Covers and Blends The Two, TAA Accumulates Jittered Frames Into A Reprojected History
+    enum AntiAliasingMode {NoAntiAliasing, MSAAAntiAliasing, FXAAAntiAliasing, SMAAAntiAliasing, TAAAntiAliasing, AntiAliasingModeCount};
+
+    // Anti-Aliasing Settings - Samples Are Clamped to What The Driver Supports, SMAA's Threshold is A Luma Difference
+    // TAA's Blend Factor is How Much of The Current Frame Goes Into The History
+    struct AntiAliasingSettings {
+        unsigned int msaaSamples {4};
+        float smaaThreshold {0.1f};
+        unsigned int smaaMaxSearchSteps {16};
+        float taaBlendFactor {0.1f};
+    };
+
+    // Anti-Aliasing - Adds The Passes Turning The Rendered Scene Into The Anti-Aliased Input of Post Processing
+    // Every Mode But MSAA Renders A Single Sampled Scene, Trading MSAA's Memory Bandwidth For Full Screen Passes
+    class AntiAliasing {
+        public:
+            // Constructor - Shaders Are Read From The Shader Directory, TAA's History Targets Are Held From The Pool Across Frames
+            AntiAliasing(const std::string &shaderDirectory, sgl::RenderTargetPool &renderTargetPool);
+
+            // Setters - Changing The Mode Drops The TAA History
+            void setMode(const sgl::AntiAliasingMode &mode);
+            void setSettings(const sgl::AntiAliasingSettings &settings);
+
+            // Samples The Scene Target Needs - Only MSAA Multisamples It
+            unsigned int getSceneSamples(void);
+
+            // Add The Passes Reading The Scene's Color (and Depth For TAA) - Returns The Resource Post Processing Reads, The Scene Itself if Nothing Runs
+            // TAA Needs The Unjittered View Projection and The Jitter in Pixels The Scene Was Rendered With
+            sgl::RenderGraphResource addPasses(sgl::RenderGraph &renderGraph, const sgl::RenderGraphResource &scene, const glm::uvec2 &size, const glm::mat4 &viewProjection, const glm::vec2 &jitter);
+
+            // Getters
+            sgl::AntiAliasingMode getMode(void);
+            const char* getModeName(void);
+            const sgl::AntiAliasingSettings& getSettings(void);
+
+            // Destroy Anti-Aliasing - Releases The History Targets
+            void destroy(void);
+        private:
+            std::string shaderDirectory;
+            sgl::RenderTargetPool* renderTargetPool;
+            sgl::AntiAliasingMode mode {sgl::AntiAliasingMode::NoAntiAliasing};
+            sgl::AntiAliasingSettings settings;
+            unsigned int maxSamples {0};
+
+            // Shaders by File Name and The Empty Vertex Array For The Full Screen Triangle
+            std::vector<std::pair<std::string, sgl::Shader>> programs;
+            GLuint vertexArray {0};
+
+            // TAA History - Read and Written Targets Swap Every Frame, The History is Invalid Until A Frame Was Accumulated at The Current Size
+            sgl::RenderTarget* historyTargets[2] {nullptr, nullptr};
+            unsigned int historyIndex {0};
+            bool historyValid {false};
+            glm::mat4 previousViewProjection {1.0f};
+
+            // Add Each Mode's Passes
+            sgl::RenderGraphResource addMSAAPasses(sgl::RenderGraph &renderGraph, const sgl::RenderGraphResource &scene, const glm::uvec2 &size);
+            sgl::RenderGraphResource addSMAAPasses(sgl::RenderGraph &renderGraph, const sgl::RenderGraphResource &scene, const glm::uvec2 &size);
+            sgl::RenderGraphResource addTAAPasses(sgl::RenderGraph &renderGraph, const sgl::RenderGraphResource &scene, const glm::uvec2 &size, const glm::mat4 &viewProjection, const glm::vec2 &jitter);
+
+            // Get A Full Screen Shader - Loaded on First Use
+            sgl::Shader& getProgram(const std::string &fileName);
+
+            // Draw A Full Screen Triangle Into A Target
+            void drawFullScreenTriangle(sgl::RenderTarget &output);
+
+            // Give The History Targets Back to The Pool
+            void releaseHistory(void);
+    };
+
+    // Camera Movement - Movement Keys Held This Frame
+    struct CameraMovement {
+        bool forward {false}, backward {false}, left {false}, right {false};
+    };
+
     // Camera
     class Camera {
         public:
@@ -191,6 +1368,9 @@ namespace sgl {
             // Process Keyboard Input - Move Around
             void processKeyboard(GLFWwindow* win, const float &deltaTime);
 
+            // Move Around From Keys Sampled Earlier - For Updating The Camera Off The Main Thread
+            void processKeyboard(const sgl::CameraMovement &movement, const float &deltaTime);
+
             // Process Mouse Movement (Look Around) and Scroll (Zoom In/Out)
             void processMouse(const double &mousePosX, const double &mousePosY);
             void processScroll(const double &scrollPosY);
@@ -198,6 +1378,15 @@ namespace sgl {
             // Getters
             glm::mat4 getViewMat(void);
             float getFOV(void);
+            glm::vec3 getPosition(void);
+            glm::vec3 getFront(void);
+
+            // Projection Matrices - The Jittered One is Offset by The Frame's Jitter Within A Target of The Given Size
+            glm::mat4 getProjectionMat(const float &aspectRatio, const float &nearPlane, const float &farPlane);
+            glm::mat4 getJitteredProjectionMat(const float &aspectRatio, const float &nearPlane, const float &farPlane, const glm::uvec2 &targetSize, const std::uint64_t &frameIndex);
+
+            // Sub-Pixel Jitter in Pixels - Halton (2, 3) Points Around The Pixel Center, Repeating Every Few Frames
+            glm::vec2 getJitter(const std::uint64_t &frameIndex);
 
             // Setters
             void setFirstMouse(const bool &value);
@@ -209,4 +1398,90 @@ namespace sgl {
             float lastX, lastY;
             float yaw {-90.0f}, pitch;
     };
+
+    // Frame Input - Input Sampled on The Main Thread For One Frame, GLFW Input Can't Be Queried From Other Threads
+    struct FrameInput {
+        sgl::CameraMovement movement;
+        glm::dvec2 mousePosition {0.0};
+        bool mouseMoved {false};
+        double scrollOffset {0.0};
+
+        // Application Defined One-Shot Actions and Main Thread State
+        std::uint32_t flags {0};
+    };
+
+    // Frame State - Built by The Update Stage and Consumed by The Render Stage, The Render Stage Must Only Read This
+    struct FrameState {
+        std::uint64_t frameIndex {0};
+        double inputTime {0.0};
+        float deltaTime {0.0f};
+        glm::ivec2 viewportSize {0};
+        sgl::FrameInput input;
+
+        // Size The Scene Renders at - The Viewport Size Scaled by The Render Scale When The Frame Was Sampled
+        glm::uvec2 renderSize {0};
+
+        // View - The Projection is Jittered by jitter Pixels For TAA, The Unjittered One is What Frames Are Reprojected With
+        glm::mat4 projectionMatrix {1.0f}, unjitteredProjectionMatrix {1.0f}, viewMatrix {1.0f};
+        glm::vec2 jitter {0.0f};
+        glm::vec3 cameraPosition {0.0f};
+
+        // Draws
+        sgl::RenderQueue renderQueue;
+        std::vector<sgl::CommandBuffer> commandBuffers;
+        sgl::CullStats cullStats;
+    };
+
+    // Frame Pipeline Mode
+    // LowLatency - Sample, Update and Render Each Frame in Turn
+    // HighThroughput - Update Frame N+1 on A Job While Rendering Frame N, Adding One Frame of Input Latency
+    enum FramePipelineMode {LowLatency, HighThroughput};
+
+    // Frame Pipeline - Double Buffered Frame States With Update and Render Stages
+    class FramePipeline {
+        public:
+            // Constructor - Each Frame State Gets commandBufferCount Command Buffers
+            FramePipeline(sgl::JobSystem &jobSystem, const sgl::FramePipelineMode &mode, const std::size_t &commandBufferCount);
+
+            // Run One Frame on The Main Thread
+            // sample - Fills The Next Frame's Input and Viewport Size, Runs on The Calling Thread
+            // update - Builds The Frame State (Camera, Culling, Draw Recording) Without Touching OpenGL, Runs on A Job When Pipelined
+            // render - Submits A Built Frame State to OpenGL on The Calling Thread
+            void runFrame(const std::function<void(sgl::FrameState&)> &sample, const std::function<void(sgl::FrameState&)> &update, const std::function<void(sgl::FrameState&)> &render);
+
+            // Wait For The Update in Flight and Drop It - Call Before Destroying Anything The Update Uses
+            void flush(void);
+
+            // Setters - Switching Modes Flushes The Pipeline
+            void setMode(const sgl::FramePipelineMode &mode);
+
+            // Getters
+            sgl::FramePipelineMode getMode(void);
+
+            // Input Latency in Seconds - From Sampling A Frame's Input to Finishing Its Submission, Last Frame and Rolling Average
+            double getInputLatency(void);
+            double getAverageInputLatency(void);
+        private:
+            sgl::JobSystem* jobSystem;
+            sgl::FramePipelineMode mode;
+
+            // Frame States - readySlot Holds A Built Frame Waiting to Be Rendered, -1 When There is None
+            sgl::FrameState frames[2];
+            int readySlot {-1};
+            std::uint64_t frameIndex {0};
+            double lastInputTime {0.0};
+
+            // Update Job in Flight - Its Function is Kept Alive Until It's Done
+            std::function<void(sgl::FrameState&)> pendingUpdate;
+            sgl::JobCounter updateCounter;
+
+            // Input Latency
+            double inputLatency {0.0}, averageInputLatency {0.0};
+
+            // Sample Input Into A Frame State
+            void sampleFrame(sgl::FrameState &frame, const std::function<void(sgl::FrameState&)> &sample);
+
+            // Render A Built Frame State and Account Its Input Latency
+            void renderFrame(sgl::FrameState &frame, const std::function<void(sgl::FrameState&)> &render);
+    };
 };
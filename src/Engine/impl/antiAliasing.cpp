@@ -0,0 +1,202 @@
+#include"../Engine.hpp"
+
+// Mode Names For Stats
+static const char* modeNames[] {"None", "MSAA", "FXAA", "SMAA 1x", "TAA"};
+
+// TAA History Format - Half Floats So Small Blend Factors Don't Band
+static const GLenum historyFormat {GL_RGBA16F};
+
+// Constructor - Create The Empty Vertex Array and Query The Sample Limit
+sgl::AntiAliasing::AntiAliasing(const std::string &shaderDirectory, sgl::RenderTargetPool &renderTargetPool) {
+    this->shaderDirectory = shaderDirectory;
+    this->renderTargetPool = &renderTargetPool;
+    glGenVertexArrays(1, &this->vertexArray);
+    GLint maxSamples {0};
+    glGetIntegerv(GL_MAX_SAMPLES, &maxSamples);
+    this->maxSamples = std::max(maxSamples, 0);
+}
+
+// Setters
+void sgl::AntiAliasing::setMode(const sgl::AntiAliasingMode &mode) {
+    if(mode == this->mode) return;
+    this->releaseHistory();
+    this->mode = mode;
+}
+void sgl::AntiAliasing::setSettings(const sgl::AntiAliasingSettings &settings) {this->settings = settings;}
+
+// Samples The Scene Target Needs
+unsigned int sgl::AntiAliasing::getSceneSamples(void) {
+    return this->mode == sgl::AntiAliasingMode::MSAAAntiAliasing ? std::min(this->settings.msaaSamples, this->maxSamples) : 0;
+}
+
+// Add The Mode's Passes - FXAA Runs Later in The Post Processing Chain, So It and No Anti-Aliasing Pass The Scene Through
+sgl::RenderGraphResource sgl::AntiAliasing::addPasses(sgl::RenderGraph &renderGraph, const sgl::RenderGraphResource &scene, const glm::uvec2 &size, const glm::mat4 &viewProjection, const glm::vec2 &jitter) {
+    switch(this->mode) {
+        case sgl::AntiAliasingMode::MSAAAntiAliasing:
+            return this->getSceneSamples() > 0 ? this->addMSAAPasses(renderGraph, scene, size) : scene;
+        case sgl::AntiAliasingMode::SMAAAntiAliasing:
+            return this->addSMAAPasses(renderGraph, scene, size);
+        case sgl::AntiAliasingMode::TAAAntiAliasing:
+            return this->addTAAPasses(renderGraph, scene, size, viewProjection, jitter);
+        case sgl::AntiAliasingMode::NoAntiAliasing:
+        case sgl::AntiAliasingMode::FXAAAntiAliasing:
+        case sgl::AntiAliasingMode::AntiAliasingModeCount:
+            break;
+    }
+    return scene;
+}
+
+// MSAA - Resolve The Multisampled Scene Into A Single Sampled Target
+sgl::RenderGraphResource sgl::AntiAliasing::addMSAAPasses(sgl::RenderGraph &renderGraph, const sgl::RenderGraphResource &scene, const glm::uvec2 &size) {
+    const sgl::RenderGraphResource resolved {renderGraph.createResource("Resolved Color", {size.x, size.y, renderGraph.getDesc(scene).colorFormat, 0, 0})};
+    renderGraph.addPass("MSAA Resolve", {{scene, sgl::RenderGraphUsage::BlitSource}}, {{resolved, sgl::RenderGraphUsage::BlitDestination}}, [scene, resolved, size](sgl::RenderGraph &graph) {
+        graph.getTarget(scene)->bind(GL_READ_FRAMEBUFFER);
+        graph.getTarget(resolved)->bind(GL_DRAW_FRAMEBUFFER);
+        glBlitFramebuffer(0, 0, size.x, size.y, 0, 0, size.x, size.y, GL_COLOR_BUFFER_BIT, GL_NEAREST);
+    });
+    return resolved;
+}
+
+// SMAA 1x - Luma Edges, Then Coverage Weights From The Shape of Each Edge's Run, Then Blending With The Neighbors Across The Edges
+sgl::RenderGraphResource sgl::AntiAliasing::addSMAAPasses(sgl::RenderGraph &renderGraph, const sgl::RenderGraphResource &scene, const glm::uvec2 &size) {
+    const sgl::RenderGraphResource edges {renderGraph.createResource("SMAA Edges", {size.x, size.y, GL_RG8, 0, 0})};
+    const sgl::RenderGraphResource weights {renderGraph.createResource("SMAA Weights", {size.x, size.y, GL_RGBA8, 0, 0})};
+    const sgl::RenderGraphResource output {renderGraph.createResource("SMAA Output", {size.x, size.y, renderGraph.getDesc(scene).colorFormat, 0, 0})};
+
+    renderGraph.addPass("SMAA Edges", {{scene, sgl::RenderGraphUsage::SampledTexture}}, {{edges, sgl::RenderGraphUsage::ColorAttachment}}, [this, scene, edges](sgl::RenderGraph &graph) {
+        sgl::Shader &shader {this->getProgram("smaaEdgeFragmentShader.glsl")};
+        shader.use();
+        shader.setInt("inputTexture", 0);
+        shader.setFloat("threshold", this->settings.smaaThreshold);
+        glActiveTexture(GL_TEXTURE0);
+        graph.getTarget(scene)->bindColorTexture();
+        this->drawFullScreenTriangle(*graph.getTarget(edges));
+    });
+    renderGraph.addPass("SMAA Weights", {{edges, sgl::RenderGraphUsage::SampledTexture}}, {{weights, sgl::RenderGraphUsage::ColorAttachment}}, [this, edges, weights](sgl::RenderGraph &graph) {
+        sgl::Shader &shader {this->getProgram("smaaWeightFragmentShader.glsl")};
+        shader.use();
+        shader.setInt("edgesTexture", 0);
+        shader.setInt("maxSearchSteps", this->settings.smaaMaxSearchSteps);
+        glActiveTexture(GL_TEXTURE0);
+        graph.getTarget(edges)->bindColorTexture();
+        this->drawFullScreenTriangle(*graph.getTarget(weights));
+    });
+    renderGraph.addPass("SMAA Blend", {{scene, sgl::RenderGraphUsage::SampledTexture}, {weights, sgl::RenderGraphUsage::SampledTexture}}, {{output, sgl::RenderGraphUsage::ColorAttachment}}, [this, scene, weights, output](sgl::RenderGraph &graph) {
+        sgl::Shader &shader {this->getProgram("smaaBlendFragmentShader.glsl")};
+        shader.use();
+        shader.setInt("inputTexture", 0);
+        shader.setInt("weightsTexture", 1);
+        glActiveTexture(GL_TEXTURE0);
+        graph.getTarget(scene)->bindColorTexture();
+        glActiveTexture(GL_TEXTURE1);
+        graph.getTarget(weights)->bindColorTexture();
+        glActiveTexture(GL_TEXTURE0);
+        this->drawFullScreenTriangle(*graph.getTarget(output));
+    });
+    return output;
+}
+
+// TAA - Motion Vectors From The Scene's Depth and Both Frames' View Projections, Then The History Reprojected by Them is Clamped to The Current Neighborhood and Blended In
+// Only The Camera Moves in The Scene, So Reprojecting Depth Gives Every Pixel's Motion Without Per Object Velocities
+sgl::RenderGraphResource sgl::AntiAliasing::addTAAPasses(sgl::RenderGraph &renderGraph, const sgl::RenderGraphResource &scene, const glm::uvec2 &size, const glm::mat4 &viewProjection, const glm::vec2 &jitter) {
+    // (Re)Acquire The History Targets at This Size - New Ones Hold Nothing Yet
+    const sgl::RenderTargetDesc historyDesc {size.x, size.y, historyFormat, 0, 0};
+    if(this->historyTargets[0] == nullptr || this->historyTargets[0]->desc != historyDesc) {
+        this->releaseHistory();
+        this->historyTargets[0] = this->renderTargetPool->acquire(historyDesc);
+        this->historyTargets[1] = this->renderTargetPool->acquire(historyDesc);
+    }
+    const sgl::RenderGraphResource history {renderGraph.importResource("TAA History", *this->historyTargets[this->historyIndex])};
+    const sgl::RenderGraphResource resolved {renderGraph.importResource("TAA Output", *this->historyTargets[1 - this->historyIndex])};
+    const sgl::RenderGraphResource motionVectors {renderGraph.createResource("Motion Vectors", {size.x, size.y, GL_RG16F, 0, 0})};
+
+    // Depth Was Rendered With The Jittered Projection, So Positions Are Reconstructed With It
+    const glm::mat4 inverseViewProjection {glm::inverse(glm::translate(glm::mat4(1.0f), glm::vec3(jitter * 2.0f / glm::vec2(size), 0.0f)) * viewProjection)};
+    const glm::mat4 previousViewProjection {this->previousViewProjection};
+    renderGraph.addPass("Motion Vectors", {{scene, sgl::RenderGraphUsage::SampledTexture}}, {{motionVectors, sgl::RenderGraphUsage::ColorAttachment}}, [this, scene, motionVectors, inverseViewProjection, viewProjection, previousViewProjection](sgl::RenderGraph &graph) {
+        sgl::Shader &shader {this->getProgram("motionVectorFragmentShader.glsl")};
+        shader.use();
+        shader.setInt("depthTexture", 0);
+        shader.setMat4("inverseViewProjection", inverseViewProjection);
+        shader.setMat4("viewProjection", viewProjection);
+        shader.setMat4("previousViewProjection", previousViewProjection);
+        glActiveTexture(GL_TEXTURE0);
+        graph.getTarget(scene)->bindDepthTexture();
+        this->drawFullScreenTriangle(*graph.getTarget(motionVectors));
+    });
+
+    const bool historyValid {this->historyValid};
+    renderGraph.addPass("TAA Resolve", {{scene, sgl::RenderGraphUsage::SampledTexture}, {motionVectors, sgl::RenderGraphUsage::SampledTexture}, {history, sgl::RenderGraphUsage::SampledTexture}}, {{resolved, sgl::RenderGraphUsage::ColorAttachment}}, [this, scene, motionVectors, history, resolved, historyValid](sgl::RenderGraph &graph) {
+        sgl::Shader &shader {this->getProgram("taaFragmentShader.glsl")};
+        shader.use();
+        shader.setInt("inputTexture", 0);
+        shader.setInt("velocityTexture", 1);
+        shader.setInt("historyTexture", 2);
+        shader.setBool("historyValid", historyValid);
+        shader.setFloat("blendFactor", this->settings.taaBlendFactor);
+        glActiveTexture(GL_TEXTURE0);
+        graph.getTarget(scene)->bindColorTexture();
+        glActiveTexture(GL_TEXTURE1);
+        graph.getTarget(motionVectors)->bindColorTexture();
+        glActiveTexture(GL_TEXTURE2);
+        graph.getTarget(history)->bindColorTexture();
+        glActiveTexture(GL_TEXTURE0);
+        this->drawFullScreenTriangle(*graph.getTarget(resolved));
+    });
+
+    // This Frame's Result is The Next Frame's History
+    this->previousViewProjection = viewProjection;
+    this->historyIndex = 1 - this->historyIndex;
+    this->historyValid = true;
+    return resolved;
+}
+
+// Get A Full Screen Shader - Every One Shares The Full Screen Vertex Shader
+sgl::Shader& sgl::AntiAliasing::getProgram(const std::string &fileName) {
+    for(std::pair<std::string, sgl::Shader> &program : this->programs) {
+        if(program.first == fileName) return program.second;
+    }
+    sgl::Shader shader;
+    shader.attachShader(this->shaderDirectory + "/vertexShader.glsl", sgl::ShaderType::VertexShader);
+    shader.attachShader(this->shaderDirectory + '/' + fileName, sgl::ShaderType::FragmentShader);
+    shader.link();
+    this->programs.push_back({fileName, shader});
+    return this->programs.back().second;
+}
+
+// Draw A Full Screen Triangle Into A Target
+void sgl::AntiAliasing::drawFullScreenTriangle(sgl::RenderTarget &output) {
+    output.bind(GL_FRAMEBUFFER);
+    glViewport(0, 0, output.desc.width, output.desc.height);
+    glDisable(GL_DEPTH_TEST);
+    glBindVertexArray(this->vertexArray);
+    glDrawArrays(GL_TRIANGLES, 0, 3);
+    SGL_STAT_ADD(sgl::StatCounter::DrawCallCount, 1);
+    SGL_STAT_ADD(sgl::StatCounter::TriangleCount, 1);
+    glBindVertexArray(0);
+}
+
+// Give The History Targets Back to The Pool
+void sgl::AntiAliasing::releaseHistory(void) {
+    for(sgl::RenderTarget* &target : this->historyTargets) {
+        if(target != nullptr) this->renderTargetPool->release(target);
+        target = nullptr;
+    }
+    this->historyIndex = 0;
+    this->historyValid = false;
+}
+
+// Getters
+sgl::AntiAliasingMode sgl::AntiAliasing::getMode(void) {return this->mode;}
+const char* sgl::AntiAliasing::getModeName(void) {return modeNames[this->mode];}
+const sgl::AntiAliasingSettings& sgl::AntiAliasing::getSettings(void) {return this->settings;}
+
+// Destroy Anti-Aliasing
+void sgl::AntiAliasing::destroy(void) {
+    this->releaseHistory();
+    for(std::pair<std::string, sgl::Shader> &program : this->programs) {
+        program.second.destroy();
+    }
+    this->programs.clear();
+    glDeleteVertexArrays(1, &this->vertexArray);
+}
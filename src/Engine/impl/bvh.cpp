@@ -0,0 +1,269 @@
+#include"../Engine.hpp"
+
+// BVH Build Settings
+static const unsigned int bvhBinCount {12};
+static const unsigned int bvhMaxLeafSize {4};
+
+// Surface Area of A Bounding Box
+static float surfaceArea(const glm::vec3 &boundsMin, const glm::vec3 &boundsMax) {
+    glm::vec3 extent {glm::max(boundsMax - boundsMin, glm::vec3(0.0f))};
+    return 2.0f * (extent.x * extent.y + extent.y * extent.z + extent.z * extent.x);
+}
+
+// Ray/Bounding Box Slab Test - Returns The Entry Distance or Infinity on A Miss
+static float rayBoxDistance(const glm::vec3 &origin, const glm::vec3 &inverseDirection, const glm::vec3 &boundsMin, const glm::vec3 &boundsMax, const float &maxDistance) {
+    glm::vec3 t0 {(boundsMin - origin) * inverseDirection}, t1 {(boundsMax - origin) * inverseDirection};
+    glm::vec3 tNear {glm::min(t0, t1)}, tFar {glm::max(t0, t1)};
+    float entry {glm::max(glm::max(tNear.x, tNear.y), glm::max(tNear.z, 0.0f))};
+    float exit {glm::min(glm::min(tFar.x, tFar.y), glm::min(tFar.z, maxDistance))};
+    return entry <= exit ? entry : std::numeric_limits<float>::infinity();
+}
+
+// Recompute A Node's Bounds From Its Instances
+void sgl::SceneBVH::updateNodeBounds(sgl::BVHNode &node) {
+    node.boundsMin = glm::vec3(std::numeric_limits<float>::max());
+    node.boundsMax = glm::vec3(-std::numeric_limits<float>::max());
+    for(unsigned int i {0}; i < node.count; i++) {
+        const sgl::BoundingBox &bounds {this->instanceBounds[this->instanceIndices[node.leftFirst + i]]};
+        node.boundsMin = glm::min(node.boundsMin, bounds.min);
+        node.boundsMax = glm::max(node.boundsMax, bounds.max);
+    }
+}
+
+// Build BVH Over Instance Bounding Boxes - Instance Indices Are Positions in The Given List
+void sgl::SceneBVH::build(const std::vector<sgl::BoundingBox> &instanceBounds) {
+    // Reset BVH
+    this->instanceBounds = instanceBounds;
+    this->instanceIndices.resize(instanceBounds.size());
+    for(unsigned int i {0}; i < this->instanceIndices.size(); i++) {
+        this->instanceIndices[i] = i;
+    }
+    this->nodes.clear();
+    if(instanceBounds.empty()) return;
+    this->nodes.reserve(instanceBounds.size() * 2);
+
+    // Instance Centroids
+    std::vector<glm::vec3> centroids(instanceBounds.size());
+    for(std::size_t i {0}; i < instanceBounds.size(); i++) {
+        centroids[i] = (instanceBounds[i].min + instanceBounds[i].max) * 0.5f;
+    }
+
+    // Root Node
+    this->nodes.push_back({glm::vec3(0.0f), 0, glm::vec3(0.0f), (unsigned int)instanceBounds.size()});
+    this->updateNodeBounds(this->nodes[0]);
+
+    // Subdivide Nodes Until No Split Beats Its Leaf Cost
+    std::vector<unsigned int> stack {0};
+    while(!stack.empty()) {
+        unsigned int nodeIndex {stack.back()};
+        stack.pop_back();
+        sgl::BVHNode node {this->nodes[nodeIndex]};
+        if(node.count <= bvhMaxLeafSize) continue;
+
+        // Centroid Bounds - Bins Are Spread Across Them
+        glm::vec3 centroidMin {std::numeric_limits<float>::max()}, centroidMax {-std::numeric_limits<float>::max()};
+        for(unsigned int i {0}; i < node.count; i++) {
+            centroidMin = glm::min(centroidMin, centroids[this->instanceIndices[node.leftFirst + i]]);
+            centroidMax = glm::max(centroidMax, centroids[this->instanceIndices[node.leftFirst + i]]);
+        }
+
+        // Find The Cheapest Binned SAH Split Across All Axes
+        int bestAxis {-1};
+        unsigned int bestSplit {0};
+        float bestCost {node.count * surfaceArea(node.boundsMin, node.boundsMax)};
+        for(int axis {0}; axis < 3; axis++) {
+            float axisExtent {centroidMax[axis] - centroidMin[axis]};
+            if(axisExtent <= 0.0f) continue;
+
+            // Fill Bins
+            glm::vec3 binMin[bvhBinCount], binMax[bvhBinCount];
+            unsigned int binCount[bvhBinCount] {};
+            for(unsigned int bin {0}; bin < bvhBinCount; bin++) {
+                binMin[bin] = glm::vec3(std::numeric_limits<float>::max());
+                binMax[bin] = glm::vec3(-std::numeric_limits<float>::max());
+            }
+            float binScale {bvhBinCount / axisExtent};
+            for(unsigned int i {0}; i < node.count; i++) {
+                unsigned int instance {this->instanceIndices[node.leftFirst + i]};
+                unsigned int bin {glm::min(bvhBinCount - 1, (unsigned int)((centroids[instance][axis] - centroidMin[axis]) * binScale))};
+                binCount[bin]++;
+                binMin[bin] = glm::min(binMin[bin], instanceBounds[instance].min);
+                binMax[bin] = glm::max(binMax[bin], instanceBounds[instance].max);
+            }
+
+            // Sweep Bins From Both Sides to Get The Area and Count Left/Right of Every Split Plane
+            float leftArea[bvhBinCount - 1], rightArea[bvhBinCount - 1];
+            unsigned int leftCount[bvhBinCount - 1], rightCount[bvhBinCount - 1];
+            glm::vec3 leftMin {std::numeric_limits<float>::max()}, leftMax {-std::numeric_limits<float>::max()};
+            glm::vec3 rightMin {leftMin}, rightMax {leftMax};
+            unsigned int leftSum {0}, rightSum {0};
+            for(unsigned int i {0}; i < bvhBinCount - 1; i++) {
+                leftSum += binCount[i];
+                leftMin = glm::min(leftMin, binMin[i]);
+                leftMax = glm::max(leftMax, binMax[i]);
+                leftCount[i] = leftSum;
+                leftArea[i] = surfaceArea(leftMin, leftMax);
+
+                unsigned int j {bvhBinCount - 1 - i};
+                rightSum += binCount[j];
+                rightMin = glm::min(rightMin, binMin[j]);
+                rightMax = glm::max(rightMax, binMax[j]);
+                rightCount[j - 1] = rightSum;
+                rightArea[j - 1] = surfaceArea(rightMin, rightMax);
+            }
+            for(unsigned int i {0}; i < bvhBinCount - 1; i++) {
+                if(leftCount[i] == 0 || rightCount[i] == 0) continue;
+                float cost {leftCount[i] * leftArea[i] + rightCount[i] * rightArea[i]};
+                if(cost < bestCost) {
+                    bestAxis = axis;
+                    bestSplit = i;
+                    bestCost = cost;
+                }
+            }
+        }
+
+        // Keep Node as A Leaf if No Split is Cheaper
+        if(bestAxis < 0) continue;
+
+        // Partition Instances Around The Split Plane
+        float binScale {bvhBinCount / (centroidMax[bestAxis] - centroidMin[bestAxis])};
+        unsigned int *first {&this->instanceIndices[node.leftFirst]}, *last {first + node.count};
+        unsigned int *middle {std::partition(first, last, [&](const unsigned int &instance) {
+            unsigned int bin {glm::min(bvhBinCount - 1, (unsigned int)((centroids[instance][bestAxis] - centroidMin[bestAxis]) * binScale))};
+            return bin <= bestSplit;
+        })};
+        unsigned int leftCount {(unsigned int)(middle - first)};
+
+        // Create Child Nodes
+        unsigned int leftChild {(unsigned int)this->nodes.size()};
+        this->nodes.push_back({glm::vec3(0.0f), node.leftFirst, glm::vec3(0.0f), leftCount});
+        this->nodes.push_back({glm::vec3(0.0f), node.leftFirst + leftCount, glm::vec3(0.0f), node.count - leftCount});
+        this->updateNodeBounds(this->nodes[leftChild]);
+        this->updateNodeBounds(this->nodes[leftChild + 1]);
+        this->nodes[nodeIndex].leftFirst = leftChild;
+        this->nodes[nodeIndex].count = 0;
+        stack.push_back(leftChild);
+        stack.push_back(leftChild + 1);
+    }
+}
+
+// Update A Moving Instance's Bounding Box - Call refit Afterwards, Rebuild if Instances Moved Far
+void sgl::SceneBVH::setInstanceBounds(const unsigned int &instance, const sgl::BoundingBox &bounds) {this->instanceBounds[instance] = bounds;}
+void sgl::SceneBVH::refit(void) {
+    // Children Are Stored After Their Parents - Walking Backwards Refits Bottom Up
+    for(std::size_t i {this->nodes.size()}; i-- > 0;) {
+        sgl::BVHNode &node {this->nodes[i]};
+        if(node.count > 0) {
+            this->updateNodeBounds(node);
+        } else {
+            const sgl::BVHNode &left {this->nodes[node.leftFirst]}, &right {this->nodes[node.leftFirst + 1]};
+            node.boundsMin = glm::min(left.boundsMin, right.boundsMin);
+            node.boundsMax = glm::max(left.boundsMax, right.boundsMax);
+        }
+    }
+}
+
+// Frustum Query - Appends Indices of Potentially Visible Instances
+void sgl::SceneBVH::cullFrustum(const sgl::Frustum &frustum, std::vector<unsigned int> &visible) const {
+    if(this->nodes.empty()) return;
+
+    // Node Stack - Second Value Marks Subtrees Already Known to Be Fully Inside The Frustum
+    std::vector<std::pair<unsigned int, bool>> stack {{0, false}};
+    while(!stack.empty()) {
+        auto [nodeIndex, fullyInside] {stack.back()};
+        stack.pop_back();
+        const sgl::BVHNode &node {this->nodes[nodeIndex]};
+
+        // Classify Node Bounds Against All Frustum Planes
+        if(!fullyInside) {
+            glm::vec3 center {(node.boundsMin + node.boundsMax) * 0.5f}, extent {(node.boundsMax - node.boundsMin) * 0.5f};
+            bool outside {false};
+            fullyInside = true;
+            for(unsigned int i {0}; i < 6; i++) {
+                const glm::vec4 &plane {frustum.getPlane(i)};
+                float distance {glm::dot(glm::vec3(plane), center) + plane.w}, radius {glm::dot(glm::abs(glm::vec3(plane)), extent)};
+                if(distance + radius < 0.0f) {
+                    outside = true;
+                    break;
+                }
+                if(distance - radius < 0.0f) fullyInside = false;
+            }
+            if(outside) continue;
+        }
+
+        // Interior Node - Visit Children
+        if(node.count == 0) {
+            stack.push_back({node.leftFirst, fullyInside});
+            stack.push_back({node.leftFirst + 1, fullyInside});
+            continue;
+        }
+
+        // Leaf Node - Test Instances Individually Unless The Whole Leaf is Inside
+        for(unsigned int i {0}; i < node.count; i++) {
+            unsigned int instance {this->instanceIndices[node.leftFirst + i]};
+            if(fullyInside || frustum.testBox(this->instanceBounds[instance])) {
+                visible.push_back(instance);
+            }
+        }
+    }
+}
+
+// Ray Query - Nearest Instance Whose Bounding Box is Hit, Optionally Refined by A Per-Instance Intersection Test Returning False on A Miss
+bool sgl::SceneBVH::raycast(const glm::vec3 &origin, const glm::vec3 &direction, sgl::RayHit &hit) const {
+    return this->raycast(origin, direction, hit, nullptr);
+}
+bool sgl::SceneBVH::raycast(const glm::vec3 &origin, const glm::vec3 &direction, sgl::RayHit &hit, const std::function<bool(const unsigned int &instance, float &distance)> &intersect) const {
+    if(this->nodes.empty()) return false;
+
+    // Closest Hit So Far
+    glm::vec3 inverseDirection {1.0f / direction};
+    float closestDistance {std::numeric_limits<float>::infinity()};
+    bool hitAny {false};
+
+    // Traverse Nearest Child First So Far Subtrees Get Rejected by The Closest Hit
+    std::vector<std::pair<unsigned int, float>> stack;
+    float rootDistance {rayBoxDistance(origin, inverseDirection, this->nodes[0].boundsMin, this->nodes[0].boundsMax, closestDistance)};
+    if(rootDistance != std::numeric_limits<float>::infinity()) stack.push_back({0, rootDistance});
+    while(!stack.empty()) {
+        auto [nodeIndex, entryDistance] {stack.back()};
+        stack.pop_back();
+        if(entryDistance >= closestDistance) continue;
+        const sgl::BVHNode &node {this->nodes[nodeIndex]};
+
+        // Leaf Node - Test Instances
+        if(node.count > 0) {
+            for(unsigned int i {0}; i < node.count; i++) {
+                unsigned int instance {this->instanceIndices[node.leftFirst + i]};
+                const sgl::BoundingBox &bounds {this->instanceBounds[instance]};
+                float distance {rayBoxDistance(origin, inverseDirection, bounds.min, bounds.max, closestDistance)};
+                if(distance == std::numeric_limits<float>::infinity()) continue;
+                if(intersect && !intersect(instance, distance)) continue;
+                if(distance < closestDistance) {
+                    closestDistance = distance;
+                    hit.instance = instance;
+                    hit.distance = distance;
+                    hitAny = true;
+                }
+            }
+            continue;
+        }
+
+        // Interior Node - Push Far Child First
+        const sgl::BVHNode &left {this->nodes[node.leftFirst]}, &right {this->nodes[node.leftFirst + 1]};
+        float leftDistance {rayBoxDistance(origin, inverseDirection, left.boundsMin, left.boundsMax, closestDistance)};
+        float rightDistance {rayBoxDistance(origin, inverseDirection, right.boundsMin, right.boundsMax, closestDistance)};
+        if(leftDistance > rightDistance) {
+            std::swap(leftDistance, rightDistance);
+            if(rightDistance != std::numeric_limits<float>::infinity()) stack.push_back({node.leftFirst, rightDistance});
+            if(leftDistance != std::numeric_limits<float>::infinity()) stack.push_back({node.leftFirst + 1, leftDistance});
+        } else {
+            if(rightDistance != std::numeric_limits<float>::infinity()) stack.push_back({node.leftFirst + 1, rightDistance});
+            if(leftDistance != std::numeric_limits<float>::infinity()) stack.push_back({node.leftFirst, leftDistance});
+        }
+    }
+    return hitAny;
+}
+
+// Getters
+std::size_t sgl::SceneBVH::getNodeCount(void) const {return this->nodes.size();}
+std::size_t sgl::SceneBVH::getInstanceCount(void) const {return this->instanceBounds.size();}
@@ -1,5 +1,19 @@
 #include"../Engine.hpp"
 
+// Jitter Points Before The Sequence Repeats - Enough to Cover The Pixel Evenly While TAA's History Still Remembers The First
+static const unsigned int jitterPhases {8};
+
+// Radical Inverse of An Index in A Base - The Halton Sequence
+static float halton(unsigned int index, const unsigned int &base) {
+    float result {0.0f}, fraction {1.0f};
+    while(index > 0) {
+        fraction /= base;
+        result += fraction * (index % base);
+        index /= base;
+    }
+    return result;
+}
+
 // Constructor - Initialize The Camera
 sgl::Camera::Camera(const glm::vec3 &position, const glm::vec3 &front, const float &moveSpeed, const float &lookSpeed, const float &fov, const float &minFOV, const float &maxFOV) {
     this->position = position;
@@ -15,13 +29,21 @@ sgl::Camera::Camera(const glm::vec3 &position, const glm::vec3 &front, const flo
 
 // Process Keyboard Input - Move Around
 void sgl::Camera::processKeyboard(GLFWwindow* win, const float &deltaTime) {
-    if(glfwGetKey(win, GLFW_KEY_W) == GLFW_PRESS) {
+    sgl::CameraMovement movement;
+    movement.forward = glfwGetKey(win, GLFW_KEY_W) == GLFW_PRESS;
+    movement.backward = glfwGetKey(win, GLFW_KEY_S) == GLFW_PRESS;
+    movement.left = glfwGetKey(win, GLFW_KEY_A) == GLFW_PRESS;
+    movement.right = glfwGetKey(win, GLFW_KEY_D) == GLFW_PRESS;
+    this->processKeyboard(movement, deltaTime);
+}
+void sgl::Camera::processKeyboard(const sgl::CameraMovement &movement, const float &deltaTime) {
+    if(movement.forward) {
         this->position += this->front * (this->moveSpeed * deltaTime);
-    } if(glfwGetKey(win, GLFW_KEY_S) == GLFW_PRESS) {
+    } if(movement.backward) {
         this->position -= this->front * (this->moveSpeed * deltaTime);
-    } if(glfwGetKey(win, GLFW_KEY_A) == GLFW_PRESS) {
+    } if(movement.left) {
         this->position -= glm::normalize(glm::cross(this->front, this->up)) * (this->moveSpeed * deltaTime);
-    } if(glfwGetKey(win, GLFW_KEY_D) == GLFW_PRESS) {
+    } if(movement.right) {
         this->position += glm::normalize(glm::cross(this->front, this->up)) * (this->moveSpeed * deltaTime);
     }
 }
@@ -77,6 +99,23 @@ void sgl::Camera::processScroll(const double &scrollPosY) {
 // Getters
 glm::mat4 sgl::Camera::getViewMat(void) {return glm::lookAt(this->position, this->position + this->front, this->up);}
 float sgl::Camera::getFOV(void) {return this->fov;}
+glm::vec3 sgl::Camera::getPosition(void) {return this->position;}
+glm::vec3 sgl::Camera::getFront(void) {return this->front;}
+
+// Projection Matrices - The Jitter Translates Clip Space, So Every Vertex Moves by The Same Sub-Pixel Offset
+glm::mat4 sgl::Camera::getProjectionMat(const float &aspectRatio, const float &nearPlane, const float &farPlane) {
+    return glm::perspective(glm::radians(this->fov), aspectRatio, nearPlane, farPlane);
+}
+glm::mat4 sgl::Camera::getJitteredProjectionMat(const float &aspectRatio, const float &nearPlane, const float &farPlane, const glm::uvec2 &targetSize, const std::uint64_t &frameIndex) {
+    const glm::vec2 offset {this->getJitter(frameIndex) * 2.0f / glm::vec2(glm::max(targetSize, glm::uvec2(1)))};
+    return glm::translate(glm::mat4(1.0f), glm::vec3(offset, 0.0f)) * this->getProjectionMat(aspectRatio, nearPlane, farPlane);
+}
+
+// Sub-Pixel Jitter - The Sequence Starts at Index One, Index Zero Would Be The Pixel Corner
+glm::vec2 sgl::Camera::getJitter(const std::uint64_t &frameIndex) {
+    const unsigned int index {(unsigned int)(frameIndex % jitterPhases) + 1};
+    return glm::vec2(halton(index, 2), halton(index, 3)) - 0.5f;
+}
 
 // Setters
 void sgl::Camera::setFirstMouse(const bool &value) {this->firstMouse = value;}
@@ -0,0 +1,120 @@
+#include"../Engine.hpp"
+
+// Command Types and Payloads - Plain Old Data So Commands Can Be Copied in and Out of The Arena Byte Wise
+enum CommandType : std::uint8_t {UseShaderCommand, BindTexturesCommand, BindVertexArrayCommand, SetMat4Command, DrawCommand};
+struct ShaderPayload {
+    sgl::Shader* shader;
+};
+struct MeshPayload {
+    sgl::Mesh* mesh;
+    sgl::Shader* shader;
+};
+struct Mat4Payload {
+    sgl::Shader* shader;
+    const char* uniformVarName;
+    glm::mat4 value;
+};
+struct DrawPayload {
+    sgl::Mesh* mesh;
+    GLsizei rangeCount;
+};
+static_assert(std::is_trivially_copyable_v<Mat4Payload>, "Command Payloads Must Be Trivially Copyable");
+
+// Append A Command
+template<typename Payload> void sgl::CommandBuffer::push(const std::uint8_t &type, const Payload &payload) {
+    std::size_t offset {this->arena.size()};
+    this->arena.resize(offset + 1 + sizeof(Payload));
+    this->arena[offset] = (std::byte)type;
+    std::memcpy(&this->arena[offset + 1], &payload, sizeof(Payload));
+    this->commandCount++;
+}
+
+// Record Commands
+void sgl::CommandBuffer::useShader(sgl::Shader &shader) {this->push(UseShaderCommand, ShaderPayload {&shader});}
+void sgl::CommandBuffer::bindTextures(sgl::Mesh &mesh, sgl::Shader &shader) {this->push(BindTexturesCommand, MeshPayload {&mesh, &shader});}
+void sgl::CommandBuffer::bindVertexArray(sgl::Mesh &mesh, sgl::Shader &shader) {this->push(BindVertexArrayCommand, MeshPayload {&mesh, &shader});}
+void sgl::CommandBuffer::setMat4(sgl::Shader &shader, const char* uniformVarName, const glm::mat4 &value) {this->push(SetMat4Command, Mat4Payload {&shader, uniformVarName, value});}
+
+// Draw - The Mesh's Prepared Ranges Follow The Payload, So Preparing The Mesh Again Doesn't Change What Gets Replayed
+void sgl::CommandBuffer::draw(sgl::Mesh &mesh) {
+    const std::vector<GLsizei> &counts {mesh.getDrawCounts()};
+    const std::vector<void*> &offsets {mesh.getDrawOffsets()};
+    this->push(DrawCommand, DrawPayload {&mesh, (GLsizei)counts.size()});
+    if(counts.empty()) return;
+    std::size_t offset {this->arena.size()};
+    this->arena.resize(offset + counts.size() * (sizeof(GLsizei) + sizeof(void*)));
+    std::memcpy(&this->arena[offset], counts.data(), counts.size() * sizeof(GLsizei));
+    std::memcpy(&this->arena[offset + counts.size() * sizeof(GLsizei)], offsets.data(), offsets.size() * sizeof(void*));
+}
+
+// Replay All Recorded Commands on The Current OpenGL Context
+void sgl::CommandBuffer::execute(void) {
+    std::size_t offset {0};
+    while(offset < this->arena.size()) {
+        std::uint8_t type {(std::uint8_t)this->arena[offset++]};
+        const std::byte* payload {&this->arena[offset]};
+        switch(type) {
+            case UseShaderCommand: {
+                ShaderPayload command;
+                std::memcpy(&command, payload, sizeof(command));
+                command.shader->use();
+                offset += sizeof(command);
+                break;
+            }
+            case BindTexturesCommand: {
+                MeshPayload command;
+                std::memcpy(&command, payload, sizeof(command));
+                command.mesh->bindTextures(*command.shader);
+                offset += sizeof(command);
+                break;
+            }
+            case BindVertexArrayCommand: {
+                MeshPayload command;
+                std::memcpy(&command, payload, sizeof(command));
+                command.mesh->bindVertexArray(*command.shader);
+                offset += sizeof(command);
+                break;
+            }
+            case SetMat4Command: {
+                Mat4Payload command;
+                std::memcpy(&command, payload, sizeof(command));
+                command.shader->setMat4(command.uniformVarName, command.value);
+                offset += sizeof(command);
+                break;
+            }
+            case DrawCommand: {
+                DrawPayload command;
+                std::memcpy(&command, payload, sizeof(command));
+                offset += sizeof(command);
+                if(command.rangeCount == 0) break;
+
+                // Unpack Draw Ranges - The Arena Has No Alignment
+                this->replayCounts.resize(command.rangeCount);
+                this->replayOffsets.resize(command.rangeCount);
+                std::memcpy(this->replayCounts.data(), &this->arena[offset], command.rangeCount * sizeof(GLsizei));
+                offset += command.rangeCount * sizeof(GLsizei);
+                std::memcpy(this->replayOffsets.data(), &this->arena[offset], command.rangeCount * sizeof(void*));
+                offset += command.rangeCount * sizeof(void*);
+                command.mesh->draw(this->replayCounts.data(), this->replayOffsets.data(), command.rangeCount);
+                break;
+            }
+            default:
+                // Display Error Message and Stop Replaying - The Rest of The Arena Can't Be Decoded
+                std::cerr << "Invalid Command Buffer Command!" << std::endl;
+                offset = this->arena.size();
+        }
+    }
+
+    // Unbind VAO
+    glBindVertexArray(0);
+}
+
+// Drop All Recorded Commands - The Arena Keeps Its Memory For The Next Frame
+void sgl::CommandBuffer::reset(void) {
+    this->arena.clear();
+    this->commandCount = 0;
+}
+
+// Getters
+std::size_t sgl::CommandBuffer::getCommandCount(void) {return this->commandCount;}
+std::size_t sgl::CommandBuffer::getSize(void) {return this->arena.size();}
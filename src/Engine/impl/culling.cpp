@@ -0,0 +1,207 @@
+#include"../Engine.hpp"
+
+// Add A Bounding Box
+void sgl::BoundingBoxList::add(const sgl::BoundingBox &box) {
+    glm::vec3 center {(box.min + box.max) * 0.5f}, extent {(box.max - box.min) * 0.5f};
+    this->centerX.push_back(center.x);
+    this->centerY.push_back(center.y);
+    this->centerZ.push_back(center.z);
+    this->extentX.push_back(extent.x);
+    this->extentY.push_back(extent.y);
+    this->extentZ.push_back(extent.z);
+}
+
+// Number of Bounding Boxes/Clear All Bounding Boxes
+std::size_t sgl::BoundingBoxList::size(void) const {return this->centerX.size();}
+void sgl::BoundingBoxList::clear(void) {
+    this->centerX.clear();
+    this->centerY.clear();
+    this->centerZ.clear();
+    this->extentX.clear();
+    this->extentY.clear();
+    this->extentZ.clear();
+}
+
+// Add A Meshlet's Bounds
+void sgl::MeshletBoundsList::add(const sgl::Meshlet &meshlet) {
+    this->centerX.push_back(meshlet.boundingSphere.center.x);
+    this->centerY.push_back(meshlet.boundingSphere.center.y);
+    this->centerZ.push_back(meshlet.boundingSphere.center.z);
+    this->radius.push_back(meshlet.boundingSphere.radius);
+    this->coneAxisX.push_back(meshlet.coneAxis.x);
+    this->coneAxisY.push_back(meshlet.coneAxis.y);
+    this->coneAxisZ.push_back(meshlet.coneAxis.z);
+    this->coneCutoff.push_back(meshlet.coneCutoff);
+}
+
+// Number of Meshlets/Clear All Meshlet Bounds
+std::size_t sgl::MeshletBoundsList::size(void) const {return this->centerX.size();}
+void sgl::MeshletBoundsList::clear(void) {
+    this->centerX.clear();
+    this->centerY.clear();
+    this->centerZ.clear();
+    this->radius.clear();
+    this->coneAxisX.clear();
+    this->coneAxisY.clear();
+    this->coneAxisZ.clear();
+    this->coneCutoff.clear();
+}
+
+// Constructor - Extract and Normalize The Six Frustum Planes
+sgl::Frustum::Frustum(const glm::mat4 &matrix) {
+    // Gribb/Hartmann Plane Extraction - GLM Matrices Are Column Major so Rows Are Gathered Manually
+    glm::vec4 row0 {matrix[0][0], matrix[1][0], matrix[2][0], matrix[3][0]};
+    glm::vec4 row1 {matrix[0][1], matrix[1][1], matrix[2][1], matrix[3][1]};
+    glm::vec4 row2 {matrix[0][2], matrix[1][2], matrix[2][2], matrix[3][2]};
+    glm::vec4 row3 {matrix[0][3], matrix[1][3], matrix[2][3], matrix[3][3]};
+    this->planes[0] = row3 + row0;
+    this->planes[1] = row3 - row0;
+    this->planes[2] = row3 + row1;
+    this->planes[3] = row3 - row1;
+    this->planes[4] = row3 + row2;
+    this->planes[5] = row3 - row2;
+
+    // Normalize Planes So Sphere Radii Can Be Compared Against Plane Distances
+    for(glm::vec4 &plane : this->planes) {
+        float length {glm::length(glm::vec3(plane))};
+        if(length > 0.0f) plane /= length;
+    }
+}
+
+// Test A Single Bounding Volume - True if Potentially Visible
+bool sgl::Frustum::testBox(const sgl::BoundingBox &box) const {
+    glm::vec3 center {(box.min + box.max) * 0.5f}, extent {(box.max - box.min) * 0.5f};
+    for(const glm::vec4 &plane : this->planes) {
+        glm::vec3 normal {plane};
+        if(glm::dot(normal, center) + glm::dot(glm::abs(normal), extent) + plane.w < 0.0f) return false;
+    }
+    return true;
+}
+bool sgl::Frustum::testSphere(const sgl::BoundingSphere &sphere) const {
+    for(const glm::vec4 &plane : this->planes) {
+        if(glm::dot(glm::vec3(plane), sphere.center) + plane.w < -sphere.radius) return false;
+    }
+    return true;
+}
+
+// Cull A List of Bounding Boxes - 8 (AVX) or 4 (SSE) at A Time, Appends Indices of Potentially Visible Boxes
+void sgl::Frustum::cullBoxes(const sgl::BoundingBoxList &boxes, std::vector<unsigned int> &visible) const {
+    const std::size_t boxCount {boxes.size()};
+    std::size_t i {0};
+
+#if defined(__AVX__)
+    // 8 Boxes at A Time
+    for(; i + 8 <= boxCount; i += 8) {
+        __m256 centerX {_mm256_loadu_ps(&boxes.centerX[i])}, centerY {_mm256_loadu_ps(&boxes.centerY[i])}, centerZ {_mm256_loadu_ps(&boxes.centerZ[i])};
+        __m256 extentX {_mm256_loadu_ps(&boxes.extentX[i])}, extentY {_mm256_loadu_ps(&boxes.extentY[i])}, extentZ {_mm256_loadu_ps(&boxes.extentZ[i])};
+        __m256 inside {_mm256_castsi256_ps(_mm256_set1_epi32(-1))};
+        for(const glm::vec4 &plane : this->planes) {
+            __m256 distance {_mm256_set1_ps(plane.w)};
+            distance = _mm256_add_ps(distance, _mm256_mul_ps(centerX, _mm256_set1_ps(plane.x)));
+            distance = _mm256_add_ps(distance, _mm256_mul_ps(centerY, _mm256_set1_ps(plane.y)));
+            distance = _mm256_add_ps(distance, _mm256_mul_ps(centerZ, _mm256_set1_ps(plane.z)));
+            distance = _mm256_add_ps(distance, _mm256_mul_ps(extentX, _mm256_set1_ps(glm::abs(plane.x))));
+            distance = _mm256_add_ps(distance, _mm256_mul_ps(extentY, _mm256_set1_ps(glm::abs(plane.y))));
+            distance = _mm256_add_ps(distance, _mm256_mul_ps(extentZ, _mm256_set1_ps(glm::abs(plane.z))));
+            inside = _mm256_and_ps(inside, _mm256_cmp_ps(distance, _mm256_setzero_ps(), _CMP_GE_OQ));
+        }
+        for(unsigned int mask {(unsigned int)_mm256_movemask_ps(inside)}; mask != 0; mask &= mask - 1) {
+            visible.push_back(i + std::countr_zero(mask));
+        }
+    }
+#endif
+
+#if defined(__SSE__)
+    // 4 Boxes at A Time
+    for(; i + 4 <= boxCount; i += 4) {
+        __m128 centerX {_mm_loadu_ps(&boxes.centerX[i])}, centerY {_mm_loadu_ps(&boxes.centerY[i])}, centerZ {_mm_loadu_ps(&boxes.centerZ[i])};
+        __m128 extentX {_mm_loadu_ps(&boxes.extentX[i])}, extentY {_mm_loadu_ps(&boxes.extentY[i])}, extentZ {_mm_loadu_ps(&boxes.extentZ[i])};
+        __m128 inside {_mm_cmpeq_ps(_mm_setzero_ps(), _mm_setzero_ps())};
+        for(const glm::vec4 &plane : this->planes) {
+            __m128 distance {_mm_set1_ps(plane.w)};
+            distance = _mm_add_ps(distance, _mm_mul_ps(centerX, _mm_set1_ps(plane.x)));
+            distance = _mm_add_ps(distance, _mm_mul_ps(centerY, _mm_set1_ps(plane.y)));
+            distance = _mm_add_ps(distance, _mm_mul_ps(centerZ, _mm_set1_ps(plane.z)));
+            distance = _mm_add_ps(distance, _mm_mul_ps(extentX, _mm_set1_ps(glm::abs(plane.x))));
+            distance = _mm_add_ps(distance, _mm_mul_ps(extentY, _mm_set1_ps(glm::abs(plane.y))));
+            distance = _mm_add_ps(distance, _mm_mul_ps(extentZ, _mm_set1_ps(glm::abs(plane.z))));
+            inside = _mm_and_ps(inside, _mm_cmpge_ps(distance, _mm_setzero_ps()));
+        }
+        for(unsigned int mask {(unsigned int)_mm_movemask_ps(inside)}; mask != 0; mask &= mask - 1) {
+            visible.push_back(i + std::countr_zero(mask));
+        }
+    }
+#endif
+
+    // Remaining Boxes One at A Time
+    for(; i < boxCount; i++) {
+        bool inside {true};
+        for(const glm::vec4 &plane : this->planes) {
+            float distance {plane.w + boxes.centerX[i] * plane.x + boxes.centerY[i] * plane.y + boxes.centerZ[i] * plane.z};
+            distance += boxes.extentX[i] * glm::abs(plane.x) + boxes.extentY[i] * glm::abs(plane.y) + boxes.extentZ[i] * glm::abs(plane.z);
+            if(distance < 0.0f) {
+                inside = false;
+                break;
+            }
+        }
+        if(inside) visible.push_back(i);
+    }
+}
+
+// Cull A List of Meshlets Against The Frustum and Their Normal Cones - 4 (SSE) at A Time, Appends Indices of Potentially Visible Meshlets
+// A Meshlet is Backfacing When dot(center - camera, coneAxis) >= coneCutoff * |center - camera| + radius
+void sgl::Frustum::cullMeshlets(const sgl::MeshletBoundsList &meshlets, const glm::vec3 &cameraPosition, std::vector<unsigned int> &visible) const {
+    const std::size_t meshletCount {meshlets.size()};
+    std::size_t i {0};
+
+#if defined(__SSE__)
+    // 4 Meshlets at A Time
+    __m128 cameraX {_mm_set1_ps(cameraPosition.x)}, cameraY {_mm_set1_ps(cameraPosition.y)}, cameraZ {_mm_set1_ps(cameraPosition.z)};
+    for(; i + 4 <= meshletCount; i += 4) {
+        __m128 centerX {_mm_loadu_ps(&meshlets.centerX[i])}, centerY {_mm_loadu_ps(&meshlets.centerY[i])}, centerZ {_mm_loadu_ps(&meshlets.centerZ[i])};
+        __m128 radius {_mm_loadu_ps(&meshlets.radius[i])}, negativeRadius {_mm_sub_ps(_mm_setzero_ps(), radius)};
+
+        // Frustum Planes
+        __m128 visibleMask {_mm_cmpeq_ps(_mm_setzero_ps(), _mm_setzero_ps())};
+        for(const glm::vec4 &plane : this->planes) {
+            __m128 distance {_mm_set1_ps(plane.w)};
+            distance = _mm_add_ps(distance, _mm_mul_ps(centerX, _mm_set1_ps(plane.x)));
+            distance = _mm_add_ps(distance, _mm_mul_ps(centerY, _mm_set1_ps(plane.y)));
+            distance = _mm_add_ps(distance, _mm_mul_ps(centerZ, _mm_set1_ps(plane.z)));
+            visibleMask = _mm_and_ps(visibleMask, _mm_cmpge_ps(distance, negativeRadius));
+        }
+
+        // Normal Cones
+        __m128 viewX {_mm_sub_ps(centerX, cameraX)}, viewY {_mm_sub_ps(centerY, cameraY)}, viewZ {_mm_sub_ps(centerZ, cameraZ)};
+        __m128 viewLength {_mm_sqrt_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(viewX, viewX), _mm_mul_ps(viewY, viewY)), _mm_mul_ps(viewZ, viewZ)))};
+        __m128 viewDot {_mm_mul_ps(viewX, _mm_loadu_ps(&meshlets.coneAxisX[i]))};
+        viewDot = _mm_add_ps(viewDot, _mm_mul_ps(viewY, _mm_loadu_ps(&meshlets.coneAxisY[i])));
+        viewDot = _mm_add_ps(viewDot, _mm_mul_ps(viewZ, _mm_loadu_ps(&meshlets.coneAxisZ[i])));
+        __m128 backfaceThreshold {_mm_add_ps(_mm_mul_ps(_mm_loadu_ps(&meshlets.coneCutoff[i]), viewLength), radius)};
+        visibleMask = _mm_and_ps(visibleMask, _mm_cmplt_ps(viewDot, backfaceThreshold));
+
+        for(unsigned int mask {(unsigned int)_mm_movemask_ps(visibleMask)}; mask != 0; mask &= mask - 1) {
+            visible.push_back(i + std::countr_zero(mask));
+        }
+    }
+#endif
+
+    // Remaining Meshlets One at A Time
+    for(; i < meshletCount; i++) {
+        glm::vec3 center {meshlets.centerX[i], meshlets.centerY[i], meshlets.centerZ[i]};
+        bool inside {true};
+        for(const glm::vec4 &plane : this->planes) {
+            if(glm::dot(glm::vec3(plane), center) + plane.w < -meshlets.radius[i]) {
+                inside = false;
+                break;
+            }
+        }
+        if(!inside) continue;
+
+        glm::vec3 view {center - cameraPosition}, coneAxis {meshlets.coneAxisX[i], meshlets.coneAxisY[i], meshlets.coneAxisZ[i]};
+        if(glm::dot(view, coneAxis) < meshlets.coneCutoff[i] * glm::length(view) + meshlets.radius[i]) visible.push_back(i);
+    }
+}
+
+// Getters
+const glm::vec4& sgl::Frustum::getPlane(const unsigned int &index) const {return this->planes[index];}
@@ -0,0 +1,66 @@
+#include"../Engine.hpp"
+
+// Weight of The Newest Frame Time in The Smoothed Frame Time
+static const double frameTimeSmoothing {0.1};
+
+// Scales Are Multiples of This - Limits How Many Differently Sized Targets The Pool Ends Up Holding
+static const float scaleStep {0.05f};
+
+// Largest Change Per Adjustment - Over Budget Drops Quickly, Headroom Raises Slowly So The Scale Doesn't Oscillate
+static const float maxScaleDecrease {0.15f}, maxScaleIncrease {0.05f};
+
+// Budget Ratios Inside Which The Scale is Left Alone
+static const double overBudgetRatio {0.95}, underBudgetRatio {1.15};
+
+// Constructor
+sgl::DynamicResolution::DynamicResolution(const double &targetFrameTime, const float &minScale, const float &maxScale, const unsigned int &settleFrames) {
+    this->targetFrameTime = targetFrameTime;
+    this->minScale = std::clamp(minScale, scaleStep, 1.0f);
+    this->maxScale = std::clamp(maxScale, this->minScale, 1.0f);
+    this->scale = this->maxScale;
+    this->settleFrames = settleFrames;
+}
+
+// Feed The Latest GPU Frame Time
+float sgl::DynamicResolution::update(const double &gpuFrameTime) {
+    if(!this->enabled || gpuFrameTime <= 0.0) return this->scale;
+
+    // Smooth Out Single Frame Spikes
+    this->smoothedFrameTime = this->smoothedFrameTime == 0.0 ? gpuFrameTime : this->smoothedFrameTime + (gpuFrameTime - this->smoothedFrameTime) * frameTimeSmoothing;
+
+    // Wait Until The Frames Rendered at The Last Scale Have Been Timed
+    if(++this->framesSinceChange < this->settleFrames) return this->scale;
+
+    // Scale Pixel Count by The Budget Ratio
+    const double budgetRatio {this->targetFrameTime / this->smoothedFrameTime};
+    if(budgetRatio > overBudgetRatio && budgetRatio < underBudgetRatio) return this->scale;
+    float newScale {this->scale * (float)std::sqrt(budgetRatio)};
+    newScale = std::clamp(newScale, this->scale - maxScaleDecrease, this->scale + maxScaleIncrease);
+    newScale = std::clamp(std::round(newScale / scaleStep) * scaleStep, this->minScale, this->maxScale);
+    if(newScale == this->scale) return this->scale;
+
+    // Times Measured at The Old Scale No Longer Apply
+    this->scale = newScale;
+    this->framesSinceChange = 0;
+    this->smoothedFrameTime = 0.0;
+    return this->scale;
+}
+
+// Setters
+void sgl::DynamicResolution::setScale(const float &scale) {
+    this->scale = std::clamp(scale, this->minScale, this->maxScale);
+    this->framesSinceChange = 0;
+    this->smoothedFrameTime = 0.0;
+}
+void sgl::DynamicResolution::setEnabled(const bool &enabled) {
+    this->enabled = enabled;
+    this->framesSinceChange = 0;
+    this->smoothedFrameTime = 0.0;
+}
+
+// Getters
+float sgl::DynamicResolution::getScale(void) {return this->scale;}
+bool sgl::DynamicResolution::isEnabled(void) {return this->enabled;}
+glm::uvec2 sgl::DynamicResolution::getScaledSize(const glm::ivec2 &size) {
+    return glm::max(glm::uvec2(glm::vec2(size) * this->scale + 0.5f), glm::uvec2(1));
+}
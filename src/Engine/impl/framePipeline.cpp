@@ -0,0 +1,78 @@
+#include"../Engine.hpp"
+
+// Weight of The Newest Frame in The Rolling Average Input Latency
+static const double latencySmoothing {0.05};
+
+// Constructor
+sgl::FramePipeline::FramePipeline(sgl::JobSystem &jobSystem, const sgl::FramePipelineMode &mode, const std::size_t &commandBufferCount) {
+    this->jobSystem = &jobSystem;
+    this->mode = mode;
+    for(sgl::FrameState &frame : this->frames) {
+        frame.commandBuffers.resize(commandBufferCount);
+    }
+}
+
+// Run One Frame
+void sgl::FramePipeline::runFrame(const std::function<void(sgl::FrameState&)> &sample, const std::function<void(sgl::FrameState&)> &update, const std::function<void(sgl::FrameState&)> &render) {
+    if(this->mode == sgl::FramePipelineMode::LowLatency) {
+        // Sample, Update and Render Back to Back in One Slot
+        this->sampleFrame(this->frames[0], sample);
+        update(this->frames[0]);
+        this->renderFrame(this->frames[0], render);
+        return;
+    }
+
+    // Finish The Update Started Last Frame - The First Frame Has to Be Built Here
+    this->jobSystem->wait(this->updateCounter);
+    if(this->readySlot < 0) {
+        this->sampleFrame(this->frames[0], sample);
+        update(this->frames[0]);
+        this->readySlot = 0;
+    }
+
+    // Start Updating The Next Frame in The Other Slot, Then Render The Built One Meanwhile
+    const int renderSlot {this->readySlot}, updateSlot {1 - renderSlot};
+    this->sampleFrame(this->frames[updateSlot], sample);
+    this->pendingUpdate = update;
+    this->jobSystem->run([this, updateSlot](void) {this->pendingUpdate(this->frames[updateSlot]);}, &this->updateCounter);
+    this->readySlot = updateSlot;
+    this->renderFrame(this->frames[renderSlot], render);
+}
+
+// Sample Input Into A Frame State
+void sgl::FramePipeline::sampleFrame(sgl::FrameState &frame, const std::function<void(sgl::FrameState&)> &sample) {
+    frame.frameIndex = this->frameIndex++;
+    frame.input = sgl::FrameInput();
+    sample(frame);
+
+    // Delta Time Between Input Samples - The Update Simulates Exactly The Time The Sampled Input Covers
+    frame.inputTime = glfwGetTime();
+    frame.deltaTime = this->lastInputTime > 0.0 ? frame.inputTime - this->lastInputTime : 0.0f;
+    this->lastInputTime = frame.inputTime;
+}
+
+// Render A Built Frame State and Account Its Input Latency
+void sgl::FramePipeline::renderFrame(sgl::FrameState &frame, const std::function<void(sgl::FrameState&)> &render) {
+    render(frame);
+    this->inputLatency = glfwGetTime() - frame.inputTime;
+    this->averageInputLatency = this->averageInputLatency == 0.0 ? this->inputLatency : this->averageInputLatency + (this->inputLatency - this->averageInputLatency) * latencySmoothing;
+}
+
+// Wait For The Update in Flight and Drop It
+void sgl::FramePipeline::flush(void) {
+    this->jobSystem->wait(this->updateCounter);
+    this->readySlot = -1;
+    this->pendingUpdate = nullptr;
+}
+
+// Setters
+void sgl::FramePipeline::setMode(const sgl::FramePipelineMode &mode) {
+    if(mode == this->mode) return;
+    this->flush();
+    this->mode = mode;
+}
+
+// Getters
+sgl::FramePipelineMode sgl::FramePipeline::getMode(void) {return this->mode;}
+double sgl::FramePipeline::getInputLatency(void) {return this->inputLatency;}
+double sgl::FramePipeline::getAverageInputLatency(void) {return this->averageInputLatency;}
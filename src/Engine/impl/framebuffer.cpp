@@ -104,9 +104,15 @@ void sgl::Framebuffer::createDepthStencilTex(const GLenum &format) {
         // Unbind Depth and Stencil Buffer Texture
         glBindTexture(GL_TEXTURE_2D_MULTISAMPLE, 0);
     } else {
-        // Create Non-Antialiased Depth and Stencil Buffer Texture
+        // Create Non-Antialiased Depth and Stencil Buffer Texture - Immutable Storage Accepts Any Depth/Stencil Format
         glBindTexture(GL_TEXTURE_2D, this->depthStencilTex);
-        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB, this->windowWidth, this->windowHeight, 0, GL_RGB, GL_UNSIGNED_BYTE, nullptr);
+        glTexStorage2D(GL_TEXTURE_2D, 1, format, this->windowWidth, this->windowHeight);
+
+        // Texture Parameters - Sampled Without Mipmaps For Depth Reads
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
 
         // Attach Depth and Stencil Buffer Texture to Framebuffer Object
         glFramebufferTexture2D(GL_FRAMEBUFFER, GL_DEPTH_STENCIL_ATTACHMENT, GL_TEXTURE_2D, this->depthStencilTex, 0);
@@ -130,6 +136,7 @@ void sgl::Framebuffer::createDepthStencilTex(const GLenum &format) {
 void sgl::Framebuffer::bind(const GLenum &bindTarget) {
     if(bindTarget == GL_FRAMEBUFFER || bindTarget == GL_READ_FRAMEBUFFER || bindTarget == GL_DRAW_FRAMEBUFFER) {
         glBindFramebuffer(bindTarget, this->framebuffer);
+        SGL_STAT_ADD(sgl::StatCounter::StateChangeCount, 1);
     } else {
         // Display Error Message
         std::cerr << "Invalid Framebuffer Bind Target!" << std::endl;
@@ -141,6 +148,15 @@ void sgl::Framebuffer::bindColorBufferTex(void) {
     } else {
         glBindTexture(GL_TEXTURE_2D, this->colorBufferTex);
     }
+    SGL_STAT_ADD(sgl::StatCounter::TextureBindCount, 1);
+}
+void sgl::Framebuffer::bindDepthStencilTex(void) {
+    if(this->msaaEnabled) {
+        glBindTexture(GL_TEXTURE_2D_MULTISAMPLE, this->depthStencilTex);
+    } else {
+        glBindTexture(GL_TEXTURE_2D, this->depthStencilTex);
+    }
+    SGL_STAT_ADD(sgl::StatCounter::TextureBindCount, 1);
 }
 
 // Unbind Framebuffer Object
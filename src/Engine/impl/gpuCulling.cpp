@@ -0,0 +1,157 @@
+#include"../Engine.hpp"
+
+// Culling Compute Shader Work Group Size - Must Match local_size_x in The Culling Compute Shader
+static const unsigned int cullWorkGroupSize {64};
+
+// Constructor - Load Culling Compute Shader and Create Buffers
+sgl::GPUCuller::GPUCuller(const std::string &computeShaderFilePath) {
+    // Culling Compute Shader
+    this->cullShader.attachShader(computeShaderFilePath, sgl::ShaderType::ComputeShader);
+    this->cullShader.link();
+
+    // Buffers
+    glGenBuffers(1, &this->instanceBuffer);
+    glGenBuffers(1, &this->instanceIndexBuffer);
+    glGenBuffers(1, &this->visibilityBuffer);
+    glGenBuffers(2, this->commandBuffers);
+    glGenBuffers(2, this->drawCountBuffers);
+    for(GLuint drawCountBuffer : this->drawCountBuffers) {
+        glBindBuffer(GL_PARAMETER_BUFFER, drawCountBuffer);
+        glBufferData(GL_PARAMETER_BUFFER, sizeof(GLuint), nullptr, GL_DYNAMIC_DRAW);
+    }
+    glBindBuffer(GL_PARAMETER_BUFFER, 0);
+
+    // Compacted Draw Commands Need glMultiDrawElementsIndirectCount (OpenGL 4.6), Mesa llvmpipe Falls Back to Zeroed Commands
+    this->indirectCountSupported = GLAD_GL_VERSION_4_6;
+}
+
+// Upload Instance Model Matrices
+void sgl::GPUCuller::setInstances(const std::vector<glm::mat4> &modelMatrices) {
+    this->instanceCount = modelMatrices.size();
+
+    // Instance Model Matrices
+    glBindBuffer(GL_SHADER_STORAGE_BUFFER, this->instanceBuffer);
+    glBufferData(GL_SHADER_STORAGE_BUFFER, modelMatrices.size() * sizeof(glm::mat4), modelMatrices.data(), GL_DYNAMIC_DRAW);
+    SGL_STAT_ADD(sgl::StatCounter::BufferUploadBytes, modelMatrices.size() * sizeof(glm::mat4));
+    glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
+
+    // Instance Indices - Fetched Per Instance So baseInstance Selects The Model Matrix
+    std::vector<GLuint> instanceIndices(modelMatrices.size());
+    for(GLuint i {0}; i < instanceIndices.size(); i++) {
+        instanceIndices[i] = i;
+    }
+    glBindBuffer(GL_ARRAY_BUFFER, this->instanceIndexBuffer);
+    glBufferData(GL_ARRAY_BUFFER, instanceIndices.size() * sizeof(GLuint), instanceIndices.data(), GL_STATIC_DRAW);
+    SGL_STAT_ADD(sgl::StatCounter::BufferUploadBytes, instanceIndices.size() * sizeof(GLuint));
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+    // Last Frame Visibility - Starts Empty So The First Frame Draws Everything in The Occlusion Retest
+    std::vector<GLuint> visibility(modelMatrices.size(), 0);
+    glBindBuffer(GL_SHADER_STORAGE_BUFFER, this->visibilityBuffer);
+    glBufferData(GL_SHADER_STORAGE_BUFFER, visibility.size() * sizeof(GLuint), visibility.data(), GL_DYNAMIC_DRAW);
+    SGL_STAT_ADD(sgl::StatCounter::BufferUploadBytes, visibility.size() * sizeof(GLuint));
+    glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
+
+    // One Draw Command Slot Per Instance
+    for(GLuint commandBuffer : this->commandBuffers) {
+        glBindBuffer(GL_DRAW_INDIRECT_BUFFER, commandBuffer);
+        glBufferData(GL_DRAW_INDIRECT_BUFFER, modelMatrices.size() * sizeof(sgl::DrawElementsIndirectCommand), nullptr, GL_DYNAMIC_DRAW);
+    }
+    glBindBuffer(GL_DRAW_INDIRECT_BUFFER, 0);
+}
+
+// Cull Instances of A Mesh - Writes Compacted Draw Commands and The Draw Count on The GPU
+void sgl::GPUCuller::cull(sgl::Mesh &mesh, const glm::mat4 &projectionViewMatrix) {
+    this->dispatchCull(mesh, projectionViewMatrix, sgl::CullPhase::FrustumOnly, nullptr);
+}
+
+// Two-Phase Occlusion Culling - Phase 1 and 2 Write Separate Command Buffers So Phase 1 Draws Stay Intact
+void sgl::GPUCuller::cull(sgl::Mesh &mesh, const glm::mat4 &projectionViewMatrix, const sgl::CullPhase &phase, sgl::HiZPyramid &hiZPyramid) {
+    this->dispatchCull(mesh, projectionViewMatrix, phase, &hiZPyramid);
+}
+void sgl::GPUCuller::dispatchCull(sgl::Mesh &mesh, const glm::mat4 &projectionViewMatrix, const sgl::CullPhase &phase, sgl::HiZPyramid* hiZPyramid) {
+    if(this->instanceCount == 0) return;
+    this->currentBuffers = phase == sgl::CullPhase::OcclusionRetest ? 1 : 0;
+
+    // Reset Draw Count
+    const GLuint zero {0};
+    glBindBuffer(GL_PARAMETER_BUFFER, this->drawCountBuffers[this->currentBuffers]);
+    glBufferSubData(GL_PARAMETER_BUFFER, 0, sizeof(GLuint), &zero);
+    SGL_STAT_ADD(sgl::StatCounter::BufferUploadBytes, sizeof(GLuint));
+    glBindBuffer(GL_PARAMETER_BUFFER, 0);
+
+    // Culling Uniforms - World Space Frustum Planes and The Mesh's Model Space Bounding Sphere
+    this->cullShader.use();
+    sgl::Frustum frustum(projectionViewMatrix);
+    for(unsigned int i {0}; i < 6; i++) {
+        this->cullShader.setVec4("frustumPlanes[" + std::to_string(i) + "]", frustum.getPlane(i));
+    }
+    const sgl::BoundingSphere &boundingSphere {mesh.getBoundingSphere()};
+    this->cullShader.setVec4("boundingSphere", glm::vec4(boundingSphere.center, boundingSphere.radius));
+    this->cullShader.setInt("instanceCount", this->instanceCount);
+    this->cullShader.setInt("indexCount", mesh.getIndexCount());
+    this->cullShader.setBool("compactCommands", this->indirectCountSupported);
+
+    // Occlusion Uniforms - The Pyramid is Only Sampled in The Retest Phase
+    this->cullShader.setInt("cullPhase", phase);
+    if(hiZPyramid != nullptr) {
+        this->cullShader.setMat4("projectionViewMatrix", projectionViewMatrix);
+        this->cullShader.setVec2("hiZSize", hiZPyramid->getSize());
+        this->cullShader.setInt("hiZMipCount", hiZPyramid->getMipCount());
+        glActiveTexture(GL_TEXTURE0);
+        hiZPyramid->bind();
+    }
+
+    // Dispatch Culling
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 0, this->instanceBuffer);
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 1, this->commandBuffers[this->currentBuffers]);
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 2, this->drawCountBuffers[this->currentBuffers]);
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 3, this->visibilityBuffer);
+    glDispatchCompute((this->instanceCount + cullWorkGroupSize - 1) / cullWorkGroupSize, 1, 1);
+    if(hiZPyramid != nullptr) glBindTexture(GL_TEXTURE_2D, 0);
+
+    // Make Draw Commands Visible to Indirect Draws
+    glMemoryBarrier(GL_COMMAND_BARRIER_BIT | GL_SHADER_STORAGE_BARRIER_BIT);
+}
+
+// Render Visible Instances of The Last Culling Phase - The Shader Reads The Model Matrix of instanceIndex (Location 3) From Binding 0
+void sgl::GPUCuller::render(sgl::Mesh &mesh, sgl::Shader &shader) {
+    if(this->instanceCount == 0) return;
+
+    // Bind Mesh and Instance Index Attribute - Per-Instance Attributes Are Offset by baseInstance
+    shader.use();
+    mesh.bind(shader);
+    glBindBuffer(GL_ARRAY_BUFFER, this->instanceIndexBuffer);
+    glVertexAttribIPointer(3, 1, GL_UNSIGNED_INT, sizeof(GLuint), (void*)0);
+    glVertexAttribDivisor(3, 1);
+    glEnableVertexAttribArray(3);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 0, this->instanceBuffer);
+
+    // Draw Visible Instances
+    glBindBuffer(GL_DRAW_INDIRECT_BUFFER, this->commandBuffers[this->currentBuffers]);
+    if(this->indirectCountSupported) {
+        glBindBuffer(GL_PARAMETER_BUFFER, this->drawCountBuffers[this->currentBuffers]);
+        glMultiDrawElementsIndirectCount(GL_TRIANGLES, mesh.getIndexType(), nullptr, 0, this->instanceCount, 0);
+        glBindBuffer(GL_PARAMETER_BUFFER, 0);
+    } else {
+        glMultiDrawElementsIndirect(GL_TRIANGLES, mesh.getIndexType(), nullptr, this->instanceCount, 0);
+    }
+    SGL_STAT_ADD(sgl::StatCounter::DrawCallCount, 1);
+    glBindBuffer(GL_DRAW_INDIRECT_BUFFER, 0);
+
+    // Detach Instance Index Attribute From The Mesh VAO and Unbind It
+    glDisableVertexAttribArray(3);
+    glVertexAttribDivisor(3, 0);
+    glBindVertexArray(0);
+}
+
+// Destroy GPU Culler
+void sgl::GPUCuller::destroy(void) {
+    this->cullShader.destroy();
+    glDeleteBuffers(1, &this->instanceBuffer);
+    glDeleteBuffers(1, &this->instanceIndexBuffer);
+    glDeleteBuffers(1, &this->visibilityBuffer);
+    glDeleteBuffers(2, this->commandBuffers);
+    glDeleteBuffers(2, this->drawCountBuffers);
+}
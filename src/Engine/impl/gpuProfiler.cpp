@@ -0,0 +1,175 @@
+#include"../Engine.hpp"
+
+// Weight of The Newest Frame in The Rolling Averages
+static const double averageSmoothing {0.05};
+
+// Most Per Frame Rows Kept For Export - About An Hour of Four Passes at 60 FPS
+static const std::size_t maxHistoryRecords {1 << 20};
+
+// Constructor - Check Timestamp Support
+sgl::GPUProfiler::GPUProfiler(const unsigned int &frameLatency) {
+    this->frames.resize(std::max(frameLatency, 1u));
+
+    // Timestamp Counter Bits - 0 Means Timestamps Aren't Usable and Only CPU Times Are Recorded
+    GLint timestampBits {0};
+    glGetQueryiv(GL_TIMESTAMP, GL_QUERY_COUNTER_BITS, &timestampBits);
+    this->gpuTimingAvailable = timestampBits > 0;
+    this->timestampMask = timestampBits >= 64 ? std::numeric_limits<std::uint64_t>::max() : ((std::uint64_t)1 << timestampBits) - 1;
+    if(!this->gpuTimingAvailable) {
+        std::cerr << "Timestamp Queries Unavailable, GPU Profiler Only Records CPU Times!" << std::endl;
+    }
+
+    // Line Up GPU Timestamps With Trace Time
+    if(timestampBits >= 64) {
+        GLint64 gpuTime {0};
+        glGetInteger64v(GL_TIMESTAMP, &gpuTime);
+        this->gpuClockOffset = gpuTime - (std::int64_t)sgl::getTraceTime();
+        this->gpuClockCalibrated = true;
+    }
+}
+
+// Begin A Frame - Resolve The Frame Recorded frameLatency Frames Ago in This Slot
+bool sgl::GPUProfiler::beginFrame(void) {
+    sgl::GPUProfilerFrame &frame {this->frames[this->frameIndex % this->frames.size()]};
+    const bool resolved {this->resolve(frame)};
+    frame.frameIndex = this->frameIndex;
+    frame.queryCount = 0;
+    frame.lastIssuedQuery = 0;
+    frame.scopes.clear();
+    this->openScopes.clear();
+    return resolved;
+}
+void sgl::GPUProfiler::endFrame(void) {
+    // Close Scopes Left Open
+    while(!this->openScopes.empty()) this->endPass();
+    this->frameIndex++;
+}
+
+// Begin A Pass Scope
+void sgl::GPUProfiler::beginPass(const std::string &name) {
+    sgl::GPUProfilerFrame &frame {this->frames[this->frameIndex % this->frames.size()]};
+
+    // Find or Add The Pass
+    unsigned int pass {0};
+    while(pass < this->passes.size() && this->passes[pass].name != name) pass++;
+    if(pass == this->passes.size()) {
+        this->passes.push_back({name});
+        this->passTraceNames.push_back(sgl::internTraceName(name));
+    }
+
+    // Two Queries From The Frame's Pool, Created When It Runs Out
+    sgl::GPUProfilerScope scope {pass, 0, 0, 0.0};
+    if(this->gpuTimingAvailable) {
+        if(frame.queryCount + 2 > frame.queries.size()) {
+            std::size_t oldSize {frame.queries.size()};
+            frame.queries.resize(oldSize + 16);
+            glGenQueries(16, &frame.queries[oldSize]);
+        }
+        scope.beginQuery = frame.queries[frame.queryCount++];
+        scope.endQuery = frame.queries[frame.queryCount++];
+        glQueryCounter(scope.beginQuery, GL_TIMESTAMP);
+        frame.lastIssuedQuery = scope.beginQuery;
+    }
+    frame.scopes.push_back(scope);
+    this->openScopes.push_back({frame.scopes.size() - 1, sgl::getTraceTime()});
+}
+
+// End The Innermost Open Pass Scope
+void sgl::GPUProfiler::endPass(void) {
+    if(this->openScopes.empty()) {
+        std::cerr << "GPU Profiler endPass Without beginPass!" << std::endl;
+        return;
+    }
+    sgl::GPUProfilerFrame &frame {this->frames[this->frameIndex % this->frames.size()]};
+    sgl::GPUProfilerScope &scope {frame.scopes[this->openScopes.back().first]};
+    if(this->gpuTimingAvailable) {
+        glQueryCounter(scope.endQuery, GL_TIMESTAMP);
+        frame.lastIssuedQuery = scope.endQuery;
+    }
+    const std::uint64_t start {this->openScopes.back().second}, duration {sgl::getTraceTime() - start};
+    scope.cpuTime = duration / 1000000.0;
+    if(sgl::isTracingEnabled()) {
+        sgl::recordTraceEvent(this->passTraceNames[scope.pass], start, duration);
+    }
+    this->openScopes.pop_back();
+}
+
+// Read Back A Frame's Queries - Frames Whose Last Issued Query Isn't Ready Yet Are Dropped Rather Than Waited For
+// Timestamps Complete in Submission Order, So Once The Last Issued One is Available Every Result Read Below is Too
+bool sgl::GPUProfiler::resolve(sgl::GPUProfilerFrame &frame) {
+    if(frame.scopes.empty()) return false;
+    if(this->gpuTimingAvailable && frame.lastIssuedQuery != 0) {
+        GLint available {GL_FALSE};
+        glGetQueryObjectiv(frame.lastIssuedQuery, GL_QUERY_RESULT_AVAILABLE, &available);
+        if(!available) {
+            this->droppedFrames++;
+            return false;
+        }
+    }
+
+    for(const sgl::GPUProfilerScope &scope : frame.scopes) {
+        // GPU Time - Masked Difference Handles Counters Narrower Than 64 Bits Wrapping Around
+        // Drivers With Imprecise Timestamps Can Report End Before Begin, Which Shows Up as Over Half The Range and is Clamped to 0
+        double gpuTime {0.0};
+        if(this->gpuTimingAvailable) {
+            GLuint64 beginTime {0}, endTime {0};
+            glGetQueryObjectui64v(scope.beginQuery, GL_QUERY_RESULT, &beginTime);
+            glGetQueryObjectui64v(scope.endQuery, GL_QUERY_RESULT, &endTime);
+            std::uint64_t ticks {(endTime - beginTime) & this->timestampMask};
+            gpuTime = ticks > this->timestampMask / 2 ? 0.0 : ticks / 1000000.0;
+
+            // GPU Timeline Event - Skipped if The Pass Started Before The Clocks Were Lined Up
+            std::int64_t traceStart {(std::int64_t)beginTime - this->gpuClockOffset};
+            if(this->gpuClockCalibrated && traceStart >= 0 && sgl::isTracingEnabled()) {
+                sgl::recordGPUTraceEvent(this->passTraceNames[scope.pass], traceStart, gpuTime > 0.0 ? ticks : 0);
+            }
+        }
+
+        // Last and Rolling Average Times
+        sgl::GPUPassTiming &timing {this->passes[scope.pass]};
+        bool firstSample {timing.averageCPUTime == 0.0 && timing.averageGPUTime == 0.0};
+        timing.gpuTime = gpuTime;
+        timing.cpuTime = scope.cpuTime;
+        timing.averageGPUTime = firstSample ? gpuTime : timing.averageGPUTime + (gpuTime - timing.averageGPUTime) * averageSmoothing;
+        timing.averageCPUTime = firstSample ? scope.cpuTime : timing.averageCPUTime + (scope.cpuTime - timing.averageCPUTime) * averageSmoothing;
+        if(this->history.size() < maxHistoryRecords) {
+            this->history.push_back({frame.frameIndex, scope.pass, gpuTime, scope.cpuTime});
+        }
+    }
+    return true;
+}
+
+// Write Every Resolved Frame as CSV
+bool sgl::GPUProfiler::exportCSV(const std::string &filePath) {
+    std::ofstream file(filePath);
+    if(!file) {
+        std::cerr << "Failed to Open GPU Profile File!" << std::endl;
+        return false;
+    }
+    file << "frame,pass,gpuMs,cpuMs\n";
+    for(const sgl::GPUProfilerRecord &record : this->history) {
+        file << record.frameIndex << ',' << this->passes[record.pass].name << ',';
+        if(this->gpuTimingAvailable) file << record.gpuTime;
+        file << ',' << record.cpuTime << '\n';
+    }
+    return (bool)file;
+}
+
+// Getters
+const std::vector<sgl::GPUPassTiming>& sgl::GPUProfiler::getPasses(void) {return this->passes;}
+const sgl::GPUPassTiming* sgl::GPUProfiler::getPass(const std::string &name) {
+    for(const sgl::GPUPassTiming &timing : this->passes) {
+        if(timing.name == name) return &timing;
+    }
+    return nullptr;
+}
+bool sgl::GPUProfiler::isGPUTimingAvailable(void) {return this->gpuTimingAvailable;}
+std::uint64_t sgl::GPUProfiler::getDroppedFrames(void) {return this->droppedFrames;}
+
+// Destroy GPU Profiler
+void sgl::GPUProfiler::destroy(void) {
+    for(sgl::GPUProfilerFrame &frame : this->frames) {
+        if(!frame.queries.empty()) glDeleteQueries(frame.queries.size(), frame.queries.data());
+        frame.queries.clear();
+    }
+}
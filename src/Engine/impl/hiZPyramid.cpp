@@ -0,0 +1,96 @@
+#include"../Engine.hpp"
+
+// Pyramid Build Compute Shader Work Group Size - Must Match local_size_x/y in The Hi-Z Compute Shader
+static const unsigned int hiZWorkGroupSize {8};
+
+// Constructor - Load Pyramid Build Compute Shader and Allocate The Mip Chain
+sgl::HiZPyramid::HiZPyramid(const std::string &computeShaderFilePath, const unsigned int &width, const unsigned int &height) {
+    // Pyramid Build Compute Shader
+    this->buildShader.attachShader(computeShaderFilePath, sgl::ShaderType::ComputeShader);
+    this->buildShader.link();
+
+    // Full Mip Chain Down to 1x1
+    this->width = width;
+    this->height = height;
+    this->allocate();
+}
+
+// Allocate The Mip Chain
+void sgl::HiZPyramid::allocate(void) {
+    this->mipCount = std::bit_width(std::max(std::max(this->width, this->height), 1u));
+
+    // Pyramid Texture - Single Channel Float So Every Level Stores The Farthest Depth of Its Footprint
+    glGenTextures(1, &this->texture);
+    glBindTexture(GL_TEXTURE_2D, this->texture);
+    glTexStorage2D(GL_TEXTURE_2D, this->mipCount, GL_R32F, this->width, this->height);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST_MIPMAP_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    glBindTexture(GL_TEXTURE_2D, 0);
+}
+
+// Resize - The Texture's Storage is Immutable, So The Mip Chain is Reallocated
+void sgl::HiZPyramid::resize(const unsigned int &width, const unsigned int &height) {
+    if(width == this->width && height == this->height) return;
+    glDeleteTextures(1, &this->texture);
+    this->width = width;
+    this->height = height;
+    this->allocate();
+}
+
+// Build Pyramid From A Non-Multisampled Depth Texture Framebuffer or Render Target
+void sgl::HiZPyramid::build(sgl::Framebuffer &depthFramebuffer) {
+    glActiveTexture(GL_TEXTURE0);
+    depthFramebuffer.bindDepthStencilTex();
+    this->buildFromBoundDepth();
+}
+void sgl::HiZPyramid::build(sgl::RenderTarget &depthTarget) {
+    glActiveTexture(GL_TEXTURE0);
+    depthTarget.bindDepthTexture();
+    this->buildFromBoundDepth();
+}
+void sgl::HiZPyramid::buildFromBoundDepth(void) {
+    this->buildShader.use();
+
+    // Level 0 - Copy Depth Buffer
+    glBindImageTexture(1, this->texture, 0, GL_FALSE, 0, GL_WRITE_ONLY, GL_R32F);
+    this->buildShader.setBool("copyDepth", true);
+    this->buildShader.setIVec2("destinationSize", glm::ivec2(this->width, this->height));
+    glDispatchCompute((this->width + hiZWorkGroupSize - 1) / hiZWorkGroupSize, (this->height + hiZWorkGroupSize - 1) / hiZWorkGroupSize, 1);
+    glBindTexture(GL_TEXTURE_2D, 0);
+
+    // Remaining Levels - Each Reduces The Previous Level, Which Must Be Fully Written First
+    this->buildShader.setBool("copyDepth", false);
+    unsigned int sourceWidth {this->width}, sourceHeight {this->height};
+    for(unsigned int level {1}; level < this->mipCount; level++) {
+        unsigned int destinationWidth {std::max(sourceWidth / 2, 1u)}, destinationHeight {std::max(sourceHeight / 2, 1u)};
+        glMemoryBarrier(GL_SHADER_IMAGE_ACCESS_BARRIER_BIT);
+        glBindImageTexture(0, this->texture, level - 1, GL_FALSE, 0, GL_READ_ONLY, GL_R32F);
+        glBindImageTexture(1, this->texture, level, GL_FALSE, 0, GL_WRITE_ONLY, GL_R32F);
+        this->buildShader.setIVec2("sourceSize", glm::ivec2(sourceWidth, sourceHeight));
+        this->buildShader.setIVec2("destinationSize", glm::ivec2(destinationWidth, destinationHeight));
+        glDispatchCompute((destinationWidth + hiZWorkGroupSize - 1) / hiZWorkGroupSize, (destinationHeight + hiZWorkGroupSize - 1) / hiZWorkGroupSize, 1);
+        sourceWidth = destinationWidth;
+        sourceHeight = destinationHeight;
+    }
+
+    // Make The Pyramid Visible to Texture Fetches in The Culling Shader
+    glMemoryBarrier(GL_TEXTURE_FETCH_BARRIER_BIT);
+}
+
+// Bind Pyramid Texture to The Active Texture Unit
+void sgl::HiZPyramid::bind(void) {
+    glBindTexture(GL_TEXTURE_2D, this->texture);
+    SGL_STAT_ADD(sgl::StatCounter::TextureBindCount, 1);
+}
+
+// Getters
+glm::vec2 sgl::HiZPyramid::getSize(void) {return glm::vec2(this->width, this->height);}
+unsigned int sgl::HiZPyramid::getMipCount(void) {return this->mipCount;}
+
+// Destroy Pyramid
+void sgl::HiZPyramid::destroy(void) {
+    this->buildShader.destroy();
+    glDeleteTextures(1, &this->texture);
+}
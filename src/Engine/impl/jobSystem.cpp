@@ -0,0 +1,289 @@
+#include"../Engine.hpp"
+
+// Identity of The Current Thread - The Job System It Belongs to and Its Index (0 is The Main Thread), External Threads Have Neither
+static thread_local sgl::JobSystem* currentJobSystem {nullptr};
+static thread_local unsigned int currentThreadIndex {0};
+
+// Number of Failed Attempts to Find A Job Before An Idle Worker Goes to Sleep
+static const unsigned int idleSpinCount {256};
+
+// Push A Job at The Bottom - Owner Only
+bool sgl::JobDeque::push(sgl::Job* job) {
+    std::int64_t bottom {this->bottom.load(std::memory_order_relaxed)};
+    std::int64_t top {this->top.load(std::memory_order_acquire)};
+    if(bottom - top >= capacity) return false;
+    this->jobs[bottom % capacity].store(job, std::memory_order_relaxed);
+    this->bottom.store(bottom + 1, std::memory_order_release);
+    return true;
+}
+
+// Pop A Job From The Bottom - Owner Only, Races Stealers Only For The Last Job
+sgl::Job* sgl::JobDeque::pop(void) {
+    std::int64_t bottom {this->bottom.load(std::memory_order_relaxed) - 1};
+    this->bottom.store(bottom, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    std::int64_t top {this->top.load(std::memory_order_relaxed)};
+    if(top > bottom) {
+        // Empty
+        this->bottom.store(bottom + 1, std::memory_order_relaxed);
+        return nullptr;
+    }
+    sgl::Job* job {this->jobs[bottom % capacity].load(std::memory_order_relaxed)};
+    if(top == bottom) {
+        // Last Job - Whoever Advances Top First Gets It
+        if(!this->top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) job = nullptr;
+        this->bottom.store(bottom + 1, std::memory_order_relaxed);
+    }
+    return job;
+}
+
+// Steal A Job From The Top - Any Thread
+sgl::Job* sgl::JobDeque::steal(void) {
+    std::int64_t top {this->top.load(std::memory_order_acquire)};
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    std::int64_t bottom {this->bottom.load(std::memory_order_acquire)};
+    if(top >= bottom) return nullptr;
+    sgl::Job* job {this->jobs[top % capacity].load(std::memory_order_relaxed)};
+    if(!this->top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) return nullptr;
+    return job;
+}
+
+// Constructor - Start Worker Threads
+sgl::JobSystem::JobSystem(const unsigned int &workerCount) {
+    unsigned int threadCount {workerCount > 0 ? workerCount + 1 : std::max(std::thread::hardware_concurrency(), 1u)};
+
+    // The Constructing Thread Becomes The Main Thread
+    currentJobSystem = this;
+    currentThreadIndex = 0;
+    for(unsigned int i {0}; i < threadCount; i++) {
+        this->threads.push_back(std::make_unique<sgl::JobThread>());
+    }
+    for(unsigned int i {1}; i < threadCount; i++) {
+        this->threads[i]->thread = std::thread(&sgl::JobSystem::workerMain, this, i);
+    }
+}
+
+// Run A Job on Any Thread
+void sgl::JobSystem::run(const std::function<void(void)> &task, sgl::JobCounter* counter) {
+    this->queue(this->allocate(task, counter));
+}
+
+// Run A Job Once A Dependency Counter Reaches Zero - The Job is Parked on The Dependency and Queued by Whoever Finishes Its Last Job
+void sgl::JobSystem::run(const std::function<void(void)> &task, sgl::JobCounter* counter, sgl::JobCounter* dependency) {
+    sgl::Job* job {this->allocate(task, counter)};
+    if(dependency != nullptr) {
+        std::lock_guard<std::mutex> lock(dependency->dependentsMutex);
+        if(dependency->pending.load(std::memory_order_acquire) > 0) {
+            dependency->dependents.push_back(job);
+            return;
+        }
+    }
+    this->queue(job);
+}
+
+// Run A Job on The Main Thread
+void sgl::JobSystem::runOnMainThread(const std::function<void(void)> &task, sgl::JobCounter* counter) {
+    if(counter != nullptr) counter->pending.fetch_add(1, std::memory_order_relaxed);
+    sgl::Job* job {new sgl::Job()};
+    job->task = task;
+    job->counter = counter;
+    job->heapAllocated = true;
+    std::lock_guard<std::mutex> lock(this->mainThreadMutex);
+    this->mainThreadJobs.push_back(job);
+}
+
+// Run All Queued Main Thread Jobs - Does Nothing on Other Threads
+void sgl::JobSystem::runMainThreadJobs(void) {
+    if(currentJobSystem != this || currentThreadIndex != 0) return;
+    while(true) {
+        sgl::Job* job {nullptr};
+        {
+            std::lock_guard<std::mutex> lock(this->mainThreadMutex);
+            if(this->mainThreadJobs.empty()) return;
+            job = this->mainThreadJobs.front();
+            this->mainThreadJobs.pop_front();
+        }
+        this->execute(job);
+    }
+}
+
+// Wait Until A Counter Reaches Zero
+void sgl::JobSystem::wait(sgl::JobCounter &counter) {
+    while(counter.pending.load(std::memory_order_acquire) > 0) {
+        this->runMainThreadJobs();
+        if(!this->tryRunJob(currentJobSystem != this)) std::this_thread::yield();
+    }
+
+    // The Thread Releasing The Last Job Holds The Mutex Until It's Done With The Counter, So It Can Be Destroyed After This
+    std::lock_guard<std::mutex> lock(counter.dependentsMutex);
+}
+
+// Split A Range Into Jobs - The First Chunk Runs on The Calling Thread
+void sgl::JobSystem::parallelFor(const std::size_t &count, const std::size_t &grainSize, const std::function<void(const std::size_t &begin, const std::size_t &end)> &function) {
+    if(count == 0) return;
+    const std::size_t chunkSize {std::max<std::size_t>(grainSize, 1)};
+    sgl::JobCounter counter;
+    for(std::size_t begin {chunkSize}; begin < count; begin += chunkSize) {
+        std::size_t end {std::min(begin + chunkSize, count)};
+        this->run([&function, begin, end](void) {function(begin, end);}, &counter);
+    }
+    function(0, std::min(chunkSize, count));
+    this->wait(counter);
+}
+
+// Allocate A Job - From The Calling Thread's Pool if It's A Job Thread and The Next Slot is Free, Else on The Heap
+sgl::Job* sgl::JobSystem::allocate(const std::function<void(void)> &task, sgl::JobCounter* counter) {
+    if(counter != nullptr) counter->pending.fetch_add(1, std::memory_order_relaxed);
+    sgl::Job* job {nullptr};
+    if(currentJobSystem == this) {
+        sgl::JobThread &jobThread {*this->threads[currentThreadIndex]};
+        sgl::Job &pooledJob {jobThread.pool[jobThread.nextJob % sgl::JobThread::poolSize]};
+        if(!pooledJob.inUse.load(std::memory_order_acquire)) {
+            jobThread.nextJob++;
+            pooledJob.inUse.store(true, std::memory_order_relaxed);
+            job = &pooledJob;
+        }
+    }
+    if(job == nullptr) {
+        job = new sgl::Job();
+        job->heapAllocated = true;
+    }
+    job->task = task;
+    job->counter = counter;
+    job->background = currentJobSystem != this;
+    return job;
+}
+
+// Queue A Job - Background Jobs Go to The Background Queue, Job Threads Push to Their Own Deque and Full Deques Overflow Into The External Queue
+void sgl::JobSystem::queue(sgl::Job* job) {
+    if(job->background) {
+        std::lock_guard<std::mutex> lock(this->externalMutex);
+        this->backgroundJobs.push_back(job);
+    } else if(currentJobSystem != this || !this->threads[currentThreadIndex]->deque.push(job)) {
+        std::lock_guard<std::mutex> lock(this->externalMutex);
+        this->externalJobs.push_back(job);
+    }
+
+    // Wake A Sleeping Worker - Sleepers Recheck queuedJobs Under The Sleep Mutex, So Locking It Here Avoids Lost Wakeups
+    this->queuedJobs.fetch_add(1, std::memory_order_seq_cst);
+    if(this->sleepingWorkers.load(std::memory_order_seq_cst) > 0) {
+        std::lock_guard<std::mutex> lock(this->sleepMutex);
+        this->sleepCondition.notify_one();
+    }
+}
+
+// Find and Run One Job - Own Deque First, Then The External Queue, Then Steal From The Other Threads, Then The Background Queue if Allowed
+bool sgl::JobSystem::tryRunJob(const bool &background) {
+    const bool jobThread {currentJobSystem == this};
+    sgl::Job* job {nullptr};
+    if(jobThread) job = this->threads[currentThreadIndex]->deque.pop();
+    if(job == nullptr) {
+        std::lock_guard<std::mutex> lock(this->externalMutex);
+        if(!this->externalJobs.empty()) {
+            job = this->externalJobs.front();
+            this->externalJobs.pop_front();
+        }
+    }
+    for(std::size_t i {1}; job == nullptr && i <= this->threads.size(); i++) {
+        std::size_t victim {((jobThread ? currentThreadIndex : 0) + i) % this->threads.size()};
+        if(jobThread && victim == currentThreadIndex) continue;
+        job = this->threads[victim]->deque.steal();
+    }
+    if(job == nullptr && background) {
+        std::lock_guard<std::mutex> lock(this->externalMutex);
+        if(!this->backgroundJobs.empty()) {
+            job = this->backgroundJobs.front();
+            this->backgroundJobs.pop_front();
+        }
+    }
+    if(job == nullptr) return false;
+    this->queuedJobs.fetch_sub(1, std::memory_order_relaxed);
+    this->execute(job);
+    return true;
+}
+
+// Run A Job and Free It - The Counter is Read First Because Pooled Slots Can Be Reused as Soon as They're Freed
+void sgl::JobSystem::execute(sgl::Job* job) {
+    {
+        SGL_PROFILE_SCOPE("Job");
+        job->task();
+    }
+    job->task = nullptr;
+    sgl::JobCounter* counter {job->counter};
+    if(job->heapAllocated) {
+        delete job;
+    } else {
+        job->inUse.store(false, std::memory_order_release);
+    }
+    if(counter != nullptr) this->release(counter);
+}
+
+// Finish One Job of A Counter - Dropping It to Zero Queues Its Dependents
+void sgl::JobSystem::release(sgl::JobCounter* counter) {
+    // Not The Last Job - Decrement Without Locking
+    unsigned int pending {counter->pending.load(std::memory_order_relaxed)};
+    while(pending > 1) {
+        if(counter->pending.compare_exchange_weak(pending, pending - 1, std::memory_order_acq_rel, std::memory_order_relaxed)) return;
+    }
+
+    // Possibly The Last Job - Dependents Are Taken Under The Mutex Before The Counter is Released, Nothing Touches It Afterwards
+    std::vector<sgl::Job*> readyJobs;
+    {
+        std::lock_guard<std::mutex> lock(counter->dependentsMutex);
+        readyJobs.swap(counter->dependents);
+        if(counter->pending.fetch_sub(1, std::memory_order_acq_rel) != 1) counter->dependents.swap(readyJobs);
+    }
+    for(sgl::Job* job : readyJobs) this->queue(job);
+}
+
+// Worker Thread - Runs Jobs Until Stopped, Spinning Briefly Before Sleeping When Idle
+void sgl::JobSystem::workerMain(const unsigned int &threadIndex) {
+    currentJobSystem = this;
+    currentThreadIndex = threadIndex;
+    sgl::setTraceThreadName("Worker " + std::to_string(threadIndex));
+    unsigned int idleSpins {0};
+    while(!this->stopping.load(std::memory_order_acquire)) {
+        if(this->tryRunJob(true)) {
+            idleSpins = 0;
+            continue;
+        }
+        if(++idleSpins < idleSpinCount) {
+            std::this_thread::yield();
+            continue;
+        }
+
+        // Sleep Until A Job is Queued
+        idleSpins = 0;
+        this->sleepingWorkers.fetch_add(1, std::memory_order_seq_cst);
+        {
+            std::unique_lock<std::mutex> lock(this->sleepMutex);
+            this->sleepCondition.wait(lock, [this](void) {
+                return this->queuedJobs.load(std::memory_order_seq_cst) > 0 || this->stopping.load(std::memory_order_acquire);
+            });
+        }
+        this->sleepingWorkers.fetch_sub(1, std::memory_order_seq_cst);
+    }
+}
+
+// Getters
+unsigned int sgl::JobSystem::getWorkerCount(void) {return this->threads.empty() ? 0 : this->threads.size() - 1;}
+
+// Destroy Job System
+void sgl::JobSystem::destroy(void) {
+    // Stop and Join Workers
+    {
+        std::lock_guard<std::mutex> lock(this->sleepMutex);
+        this->stopping.store(true, std::memory_order_release);
+        this->sleepCondition.notify_all();
+    }
+    for(std::size_t i {1}; i < this->threads.size(); i++) {
+        if(this->threads[i]->thread.joinable()) this->threads[i]->thread.join();
+    }
+    this->threads.clear();
+
+    // Drop Leftover Main Thread Jobs
+    std::lock_guard<std::mutex> lock(this->mainThreadMutex);
+    for(sgl::Job* job : this->mainThreadJobs) delete job;
+    this->mainThreadJobs.clear();
+    if(currentJobSystem == this) currentJobSystem = nullptr;
+}
@@ -0,0 +1,215 @@
+#include"../Engine.hpp"
+
+// Quadric Error Metric - Symmetric 4x4 Matrix of Summed Squared Plane Distances Stored as Its 10 Unique Coefficients
+struct Quadric {
+    double a2 {0}, ab {0}, ac {0}, ad {0}, b2 {0}, bc {0}, bd {0}, c2 {0}, cd {0}, d2 {0};
+};
+static void addPlaneQuadric(Quadric &quadric, const glm::dvec3 &normal, const double &distance) {
+    quadric.a2 += normal.x * normal.x;
+    quadric.ab += normal.x * normal.y;
+    quadric.ac += normal.x * normal.z;
+    quadric.ad += normal.x * distance;
+    quadric.b2 += normal.y * normal.y;
+    quadric.bc += normal.y * normal.z;
+    quadric.bd += normal.y * distance;
+    quadric.c2 += normal.z * normal.z;
+    quadric.cd += normal.z * distance;
+    quadric.d2 += distance * distance;
+}
+static void addQuadric(Quadric &quadric, const Quadric &other) {
+    quadric.a2 += other.a2;
+    quadric.ab += other.ab;
+    quadric.ac += other.ac;
+    quadric.ad += other.ad;
+    quadric.b2 += other.b2;
+    quadric.bc += other.bc;
+    quadric.bd += other.bd;
+    quadric.c2 += other.c2;
+    quadric.cd += other.cd;
+    quadric.d2 += other.d2;
+}
+static double evaluateQuadric(const Quadric &quadric, const glm::vec3 &position) {
+    double x {position.x}, y {position.y}, z {position.z};
+    double error {quadric.a2 * x * x + quadric.b2 * y * y + quadric.c2 * z * z + quadric.d2};
+    error += 2.0 * (quadric.ab * x * y + quadric.ac * x * z + quadric.bc * y * z + quadric.ad * x + quadric.bd * y + quadric.cd * z);
+    return glm::max(error, 0.0);
+}
+
+// Edge Collapse Candidate - Moves Vertex from Onto Vertex to
+struct EdgeCollapse {
+    GLuint from, to;
+    double cost;
+};
+
+// Check if Collapsing A Vertex Flips Any of Its Remaining Triangles
+static bool collapseFlipsTriangles(const std::vector<sgl::VertexStruct> &vertices, const std::vector<GLuint> &indices, const std::vector<GLuint> &adjacencyOffsets, const std::vector<GLuint> &adjacency, const EdgeCollapse &collapse) {
+    const glm::vec3 &target {vertices[collapse.to].position};
+    for(GLuint i {adjacencyOffsets[collapse.from]}; i < adjacencyOffsets[collapse.from + 1]; i++) {
+        const GLuint* triangle {&indices[adjacency[i] * 3]};
+        if(triangle[0] == triangle[1] || triangle[1] == triangle[2] || triangle[0] == triangle[2]) continue;
+        if(triangle[0] == collapse.to || triangle[1] == collapse.to || triangle[2] == collapse.to) continue;
+
+        // Compare Face Normals Before and After Moving The Vertex
+        glm::vec3 before[3], after[3];
+        for(int corner {0}; corner < 3; corner++) {
+            before[corner] = vertices[triangle[corner]].position;
+            after[corner] = triangle[corner] == collapse.from ? target : before[corner];
+        }
+        glm::vec3 normalBefore {glm::cross(before[1] - before[0], before[2] - before[0])};
+        glm::vec3 normalAfter {glm::cross(after[1] - after[0], after[2] - after[0])};
+        if(glm::dot(normalBefore, normalAfter) <= 0.0f) return true;
+    }
+    return false;
+}
+
+// Generate The Level of Detail Chain of Baked Mesh Data - Thread-Safe, Called by bakeMeshData
+void sgl::generateLODs(sgl::MeshData &meshData, const sgl::ModelBakeSettings &bakeSettings) {
+    const std::vector<sgl::VertexStruct> &vertices {meshData.vertices};
+    const std::size_t vertexCount {vertices.size()};
+
+    // Level 0 is The Full Mesh
+    meshData.lodLevels.clear();
+    meshData.lodLevels.push_back({0, (GLsizei)meshData.indices.size(), 0.0f});
+    if(bakeSettings.lodLevels == 0 || meshData.indices.size() < 6) return;
+
+    // Weld Vertices by Position - Only Vertices Sharing A Position With Different Attributes Form A Seam and Are Locked
+    std::vector<GLuint> sortedVertices(vertexCount), positionIds(vertexCount);
+    for(GLuint i {0}; i < vertexCount; i++) sortedVertices[i] = i;
+    auto positionLess {[&](const GLuint &a, const GLuint &b) {
+        const glm::vec3 &pa {vertices[a].position}, &pb {vertices[b].position};
+        return pa.x != pb.x ? pa.x < pb.x : (pa.y != pb.y ? pa.y < pb.y : pa.z < pb.z);
+    }};
+    std::sort(sortedVertices.begin(), sortedVertices.end(), positionLess);
+    std::vector<bool> locked(vertexCount, false);
+    for(std::size_t i {0}, groupStart {0}; i < vertexCount; i++) {
+        if(i > 0 && positionLess(sortedVertices[i - 1], sortedVertices[i])) groupStart = i;
+        positionIds[sortedVertices[i]] = sortedVertices[groupStart];
+        if(i != groupStart && std::memcmp(&vertices[sortedVertices[i]], &vertices[sortedVertices[groupStart]], sizeof(sgl::VertexStruct)) != 0) {
+            locked[sortedVertices[i]] = true;
+            locked[sortedVertices[groupStart]] = true;
+        }
+    }
+
+    // Lock Border and Non-Manifold Vertices - Edges Not Shared by Exactly Two Triangles
+    std::vector<std::uint64_t> edges;
+    edges.reserve(meshData.indices.size());
+    for(std::size_t i {0}; i + 2 < meshData.indices.size(); i += 3) {
+        for(int corner {0}; corner < 3; corner++) {
+            std::uint64_t a {positionIds[meshData.indices[i + corner]]}, b {positionIds[meshData.indices[i + (corner + 1) % 3]]};
+            edges.push_back(std::min(a, b) << 32 | std::max(a, b));
+        }
+    }
+    std::sort(edges.begin(), edges.end());
+    std::vector<bool> lockedPositions(vertexCount, false);
+    for(std::size_t i {0}; i < edges.size();) {
+        std::size_t j {i};
+        while(j < edges.size() && edges[j] == edges[i]) j++;
+        if(j - i != 2) {
+            lockedPositions[edges[i] >> 32] = true;
+            lockedPositions[edges[i] & 0xFFFFFFFF] = true;
+        }
+        i = j;
+    }
+    for(std::size_t i {0}; i < vertexCount; i++) {
+        if(lockedPositions[positionIds[i]]) locked[i] = true;
+    }
+
+    // Vertex Quadrics - Sum of The Planes of Every Adjacent Triangle
+    std::vector<Quadric> quadrics(vertexCount);
+    for(std::size_t i {0}; i + 2 < meshData.indices.size(); i += 3) {
+        glm::dvec3 p0 {vertices[meshData.indices[i]].position}, p1 {vertices[meshData.indices[i + 1]].position}, p2 {vertices[meshData.indices[i + 2]].position};
+        glm::dvec3 normal {glm::cross(p1 - p0, p2 - p0)};
+        double length {glm::length(normal)};
+        if(length == 0.0) continue;
+        normal /= length;
+        for(int corner {0}; corner < 3; corner++) {
+            addPlaneQuadric(quadrics[meshData.indices[i + corner]], normal, -glm::dot(normal, p0));
+        }
+    }
+
+    // Attribute Error Scale - Attribute Differences Are Weighted Against Squared Distances Relative to The Mesh Size
+    const double attributeScale {bakeSettings.lodAttributeWeight * meshData.boundingSphere.radius * meshData.boundingSphere.radius};
+
+    // Simplify Each Level From The Previous One, Carrying Quadrics and Collapses Over
+    std::vector<GLuint> levelIndices(meshData.indices);
+    std::vector<GLuint> adjacencyOffsets(vertexCount + 1), adjacency;
+    std::vector<EdgeCollapse> collapses;
+    std::vector<bool> touched(vertexCount);
+    double maxCollapseCost {0.0};
+    for(unsigned int level {1}; level <= bakeSettings.lodLevels; level++) {
+        const std::size_t previousTriangles {levelIndices.size() / 3};
+        const std::size_t targetTriangles {std::max<std::size_t>(previousTriangles * bakeSettings.lodTriangleRatio, 1)};
+
+        // Collapse Passes - Cheapest Independent Edges First Until The Target is Reached
+        while(levelIndices.size() / 3 > targetTriangles) {
+            const std::size_t triangleCount {levelIndices.size() / 3};
+
+            // Vertex to Triangle Adjacency
+            std::fill(adjacencyOffsets.begin(), adjacencyOffsets.end(), 0);
+            for(GLuint vertexIndex : levelIndices) adjacencyOffsets[vertexIndex + 1]++;
+            for(std::size_t i {0}; i < vertexCount; i++) adjacencyOffsets[i + 1] += adjacencyOffsets[i];
+            adjacency.resize(levelIndices.size());
+            std::vector<GLuint> fillOffsets(adjacencyOffsets.begin(), adjacencyOffsets.end() - 1);
+            for(std::size_t i {0}; i < levelIndices.size(); i++) adjacency[fillOffsets[levelIndices[i]]++] = i / 3;
+
+            // Collapse Candidates - Position Error of The Combined Quadric Plus Attribute Mismatch
+            collapses.clear();
+            for(std::size_t i {0}; i < levelIndices.size(); i += 3) {
+                for(int corner {0}; corner < 3; corner++) {
+                    GLuint from {levelIndices[i + corner]}, to {levelIndices[i + (corner + 1) % 3]};
+                    for(int direction {0}; direction < 2; direction++, std::swap(from, to)) {
+                        if(locked[from]) continue;
+                        Quadric combined {quadrics[from]};
+                        addQuadric(combined, quadrics[to]);
+                        glm::vec3 normalDelta {vertices[from].normalVector - vertices[to].normalVector};
+                        glm::vec2 texCoordDelta {vertices[from].textureCoords - vertices[to].textureCoords};
+                        double attributeError {attributeScale * (glm::dot(normalDelta, normalDelta) + glm::dot(texCoordDelta, texCoordDelta))};
+                        collapses.push_back({from, to, evaluateQuadric(combined, vertices[to].position) + attributeError});
+                    }
+                }
+            }
+            std::sort(collapses.begin(), collapses.end(), [](const EdgeCollapse &a, const EdgeCollapse &b) {return a.cost < b.cost;});
+
+            // Apply Collapses Whose Vertices Haven't Been Touched This Pass
+            std::fill(touched.begin(), touched.end(), false);
+            std::size_t remainingTriangles {triangleCount}, appliedCollapses {0};
+            for(const EdgeCollapse &collapse : collapses) {
+                if(remainingTriangles <= targetTriangles) break;
+                if(touched[collapse.from] || touched[collapse.to]) continue;
+                if(collapseFlipsTriangles(vertices, levelIndices, adjacencyOffsets, adjacency, collapse)) continue;
+
+                // Move Every Reference of The Collapsed Vertex Onto The Target
+                for(GLuint i {adjacencyOffsets[collapse.from]}; i < adjacencyOffsets[collapse.from + 1]; i++) {
+                    GLuint* triangle {&levelIndices[adjacency[i] * 3]};
+                    bool wasDegenerate {triangle[0] == triangle[1] || triangle[1] == triangle[2] || triangle[0] == triangle[2]};
+                    for(int corner {0}; corner < 3; corner++) {
+                        if(triangle[corner] == collapse.from) triangle[corner] = collapse.to;
+                    }
+                    if(!wasDegenerate && (triangle[0] == triangle[1] || triangle[1] == triangle[2] || triangle[0] == triangle[2])) remainingTriangles--;
+                }
+                addQuadric(quadrics[collapse.to], quadrics[collapse.from]);
+                maxCollapseCost = std::max(maxCollapseCost, collapse.cost);
+                touched[collapse.from] = touched[collapse.to] = true;
+                appliedCollapses++;
+            }
+
+            // Remove Degenerate Triangles
+            std::size_t writeIndex {0};
+            for(std::size_t i {0}; i < levelIndices.size(); i += 3) {
+                if(levelIndices[i] == levelIndices[i + 1] || levelIndices[i + 1] == levelIndices[i + 2] || levelIndices[i] == levelIndices[i + 2]) continue;
+                for(int corner {0}; corner < 3; corner++) levelIndices[writeIndex++] = levelIndices[i + corner];
+            }
+            levelIndices.resize(writeIndex);
+
+            // Every Remaining Edge is Locked or Would Flip Triangles
+            if(appliedCollapses == 0) break;
+        }
+
+        // Stop Once Simplification Stalls - The Level Would Barely Differ From The Previous One
+        if(levelIndices.empty() || levelIndices.size() / 3 > previousTriangles * 0.9f) break;
+
+        // Append Level - Errors Never Decrease Down The Chain
+        meshData.lodLevels.push_back({(GLuint)meshData.indices.size(), (GLsizei)levelIndices.size(), (float)glm::sqrt(maxCollapseCost)});
+        meshData.indices.insert(meshData.indices.end(), levelIndices.begin(), levelIndices.end());
+    }
+}
@@ -0,0 +1,118 @@
+#include"../Engine.hpp"
+
+// Meshlet Limits - 64 Vertices and 124 Triangles Keep Every Meshlet Within Typical Mesh Shader Output Limits
+static const std::size_t maxMeshletVertices {64};
+static const std::size_t maxMeshletTriangles {124};
+
+// Compute A Meshlet's Bounding Sphere and Normal Cone From Its Triangles
+static void computeMeshletBounds(const std::vector<sgl::VertexStruct> &vertices, const GLuint* indices, sgl::Meshlet &meshlet) {
+    // Bounding Sphere - Centered on The Bounding Box of The Meshlet's Vertices
+    glm::vec3 boundsMin {vertices[indices[0]].position}, boundsMax {boundsMin};
+    for(GLsizei i {0}; i < meshlet.indexCount; i++) {
+        boundsMin = glm::min(boundsMin, vertices[indices[i]].position);
+        boundsMax = glm::max(boundsMax, vertices[indices[i]].position);
+    }
+    meshlet.boundingSphere.center = (boundsMin + boundsMax) * 0.5f;
+    float radiusSquared {0.0f};
+    for(GLsizei i {0}; i < meshlet.indexCount; i++) {
+        glm::vec3 offset {vertices[indices[i]].position - meshlet.boundingSphere.center};
+        radiusSquared = glm::max(radiusSquared, glm::dot(offset, offset));
+    }
+    meshlet.boundingSphere.radius = glm::sqrt(radiusSquared);
+
+    // Normal Cone Axis - Average of The Triangles' Face Normals
+    std::vector<glm::vec3> faceNormals;
+    glm::vec3 normalSum {0.0f};
+    for(GLsizei i {0}; i < meshlet.indexCount; i += 3) {
+        const glm::vec3 &p0 {vertices[indices[i]].position};
+        glm::vec3 normal {glm::cross(vertices[indices[i + 1]].position - p0, vertices[indices[i + 2]].position - p0)};
+        float length {glm::length(normal)};
+        if(length == 0.0f) continue;
+        faceNormals.push_back(normal / length);
+        normalSum += faceNormals.back();
+    }
+    meshlet.coneAxis = glm::vec3(0.0f);
+    meshlet.coneCutoff = 1.0f;
+    float axisLength {glm::length(normalSum)};
+    if(axisLength == 0.0f) return;
+    meshlet.coneAxis = normalSum / axisLength;
+
+    // Normal Cone Cutoff - Normals Spreading 90 Degrees or More From The Axis Can't Be Backface Culled
+    float minimumDot {1.0f};
+    for(const glm::vec3 &normal : faceNormals) {
+        minimumDot = glm::min(minimumDot, glm::dot(meshlet.coneAxis, normal));
+    }
+    if(minimumDot > 0.0f) {
+        meshlet.coneCutoff = glm::sqrt(1.0f - minimumDot * minimumDot);
+    }
+}
+
+// Split The Full Detail Level of Baked Mesh Data Into Meshlets - Thread-Safe, Called by bakeMeshData
+void sgl::buildMeshlets(sgl::MeshData &meshData) {
+    meshData.meshlets.clear();
+    const std::size_t vertexCount {meshData.vertices.size()};
+    const std::size_t fullDetailIndices {meshData.lodLevels.empty() ? meshData.indices.size() : (std::size_t)meshData.lodLevels[0].indexCount};
+    const std::size_t triangleCount {fullDetailIndices / 3};
+    if(triangleCount == 0) return;
+
+    // Vertex to Triangle Adjacency
+    std::vector<GLuint> adjacencyOffsets(vertexCount + 1, 0), adjacency(triangleCount * 3);
+    for(std::size_t i {0}; i < triangleCount * 3; i++) adjacencyOffsets[meshData.indices[i] + 1]++;
+    for(std::size_t i {0}; i < vertexCount; i++) adjacencyOffsets[i + 1] += adjacencyOffsets[i];
+    std::vector<GLuint> fillOffsets(adjacencyOffsets.begin(), adjacencyOffsets.end() - 1);
+    for(std::size_t i {0}; i < triangleCount * 3; i++) adjacency[fillOffsets[meshData.indices[i]]++] = i / 3;
+
+    // Grow Meshlets Greedily - Each Step Adds The Adjacent Triangle Needing The Fewest New Vertices
+    std::vector<bool> emitted(triangleCount, false), inMeshlet(vertexCount, false);
+    std::vector<GLuint> meshletVertices, reorderedIndices;
+    reorderedIndices.reserve(triangleCount * 3);
+    for(std::size_t seed {0}; seed < triangleCount; seed++) {
+        if(emitted[seed]) continue;
+
+        // Start A New Meshlet From The Next Unemitted Triangle
+        sgl::Meshlet meshlet;
+        meshlet.firstIndex = reorderedIndices.size();
+        std::size_t candidate {seed};
+        while(candidate != triangleCount) {
+            // Add Candidate Triangle
+            emitted[candidate] = true;
+            for(std::size_t corner {0}; corner < 3; corner++) {
+                GLuint vertexIndex {meshData.indices[candidate * 3 + corner]};
+                if(!inMeshlet[vertexIndex]) {
+                    inMeshlet[vertexIndex] = true;
+                    meshletVertices.push_back(vertexIndex);
+                }
+                reorderedIndices.push_back(vertexIndex);
+            }
+            if((reorderedIndices.size() - meshlet.firstIndex) / 3 == maxMeshletTriangles) break;
+
+            // Pick The Next Triangle Among Those Sharing A Vertex With The Meshlet
+            std::size_t bestNewVertices {4};
+            candidate = triangleCount;
+            for(std::size_t i {0}; i < meshletVertices.size() && bestNewVertices > 0; i++) {
+                for(GLuint j {adjacencyOffsets[meshletVertices[i]]}; j < adjacencyOffsets[meshletVertices[i] + 1]; j++) {
+                    GLuint triangle {adjacency[j]};
+                    if(emitted[triangle]) continue;
+                    std::size_t newVertices {0};
+                    for(std::size_t corner {0}; corner < 3; corner++) {
+                        if(!inMeshlet[meshData.indices[triangle * 3 + corner]]) newVertices++;
+                    }
+                    if(newVertices < bestNewVertices && meshletVertices.size() + newVertices <= maxMeshletVertices) {
+                        bestNewVertices = newVertices;
+                        candidate = triangle;
+                    }
+                }
+            }
+        }
+
+        // Finish Meshlet
+        meshlet.indexCount = reorderedIndices.size() - meshlet.firstIndex;
+        computeMeshletBounds(meshData.vertices, &reorderedIndices[meshlet.firstIndex], meshlet);
+        meshData.meshlets.push_back(meshlet);
+        for(GLuint vertexIndex : meshletVertices) inMeshlet[vertexIndex] = false;
+        meshletVertices.clear();
+    }
+
+    // Replace The Full Detail Level With The Meshlet Ordered Triangles
+    std::copy(reorderedIndices.begin(), reorderedIndices.end(), meshData.indices.begin());
+}
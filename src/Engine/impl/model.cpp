@@ -1,40 +1,370 @@
 #include"../Engine.hpp"
 
+// Octahedral Normal Vector Encoding/Decoding - Must Match octahedralDecode in The Vertex Shaders
+static glm::vec2 octahedralEncode(const glm::vec3 &normalVector) {
+    float l1Norm {glm::abs(normalVector.x) + glm::abs(normalVector.y) + glm::abs(normalVector.z)};
+    if(l1Norm == 0.0f) return glm::vec2(0.0f);
+
+    glm::vec2 encoded {glm::vec2(normalVector) / l1Norm};
+    if(normalVector.z < 0.0f) {
+        encoded = (1.0f - glm::abs(glm::vec2(encoded.y, encoded.x))) * glm::vec2(encoded.x >= 0.0f ? 1.0f : -1.0f, encoded.y >= 0.0f ? 1.0f : -1.0f);
+    }
+    return encoded;
+}
+static glm::vec3 octahedralDecode(const glm::vec2 &encoded) {
+    glm::vec3 normalVector {encoded.x, encoded.y, 1.0f - glm::abs(encoded.x) - glm::abs(encoded.y)};
+    float t {glm::max(-normalVector.z, 0.0f)};
+    normalVector.x += normalVector.x >= 0.0f ? -t : t;
+    normalVector.y += normalVector.y >= 0.0f ? -t : t;
+    return glm::normalize(normalVector);
+}
+
+// Bake Compact Vertices - Leaves Them Empty if Quantization Error Exceeds The Bake Settings
+static void bakeCompactVertices(sgl::MeshData &meshData, const sgl::ModelBakeSettings &bakeSettings) {
+    // Positions Are Quantized Relative to The Mesh Bounds
+    glm::vec3 boundsMin {meshData.boundingBox.min};
+    glm::vec3 extent {meshData.boundingBox.max - meshData.boundingBox.min};
+
+    // Encode Vertices and Measure The Worst Quantization Error of Each Attribute
+    std::vector<sgl::CompactVertexStruct> compactVertices(meshData.vertices.size());
+    float positionError {0.0f}, normalErrorCos {1.0f}, texCoordError {0.0f};
+    for(std::size_t i {0}; i < meshData.vertices.size(); i++) {
+        const sgl::VertexStruct &vertex {meshData.vertices[i]};
+        sgl::CompactVertexStruct &compactVertex {compactVertices[i]};
+
+        // Position - 16-Bit Unsigned Normalized Relative to Mesh Bounds
+        glm::vec3 relativePosition {vertex.position - boundsMin};
+        for(int axis {0}; axis < 3; axis++) {
+            float normalized {extent[axis] > 0.0f ? relativePosition[axis] / extent[axis] : 0.0f};
+            compactVertex.position[axis] = glm::packUnorm1x16(normalized);
+            float decoded {boundsMin[axis] + glm::unpackUnorm1x16(compactVertex.position[axis]) * extent[axis]};
+            positionError = glm::max(positionError, glm::abs(decoded - vertex.position[axis]));
+        }
+        compactVertex.position[3] = 0;
+
+        // Normal Vector - Octahedral Encoded 2x16-Bit Signed Normalized
+        glm::vec2 encodedNormal {octahedralEncode(vertex.normalVector)};
+        compactVertex.normalVector[0] = (GLshort)glm::packSnorm1x16(encodedNormal.x);
+        compactVertex.normalVector[1] = (GLshort)glm::packSnorm1x16(encodedNormal.y);
+        if(glm::dot(vertex.normalVector, vertex.normalVector) > 0.0f) {
+            glm::vec2 quantizedNormal {glm::unpackSnorm1x16(compactVertex.normalVector[0]), glm::unpackSnorm1x16(compactVertex.normalVector[1])};
+            normalErrorCos = glm::min(normalErrorCos, glm::dot(glm::normalize(vertex.normalVector), octahedralDecode(quantizedNormal)));
+        }
+
+        // Texture Coordinates - Half-Float
+        for(int axis {0}; axis < 2; axis++) {
+            compactVertex.textureCoords[axis] = glm::packHalf1x16(vertex.textureCoords[axis]);
+            texCoordError = glm::max(texCoordError, glm::abs(glm::unpackHalf1x16(compactVertex.textureCoords[axis]) - vertex.textureCoords[axis]));
+        }
+    }
+
+    // Reject Compact Format if Any Error Bound Was Exceeded
+    float normalErrorDegrees {glm::degrees(glm::acos(glm::clamp(normalErrorCos, -1.0f, 1.0f)))};
+    if(positionError > bakeSettings.maxPositionError || normalErrorDegrees > bakeSettings.maxNormalErrorDegrees || texCoordError > bakeSettings.maxTexCoordError) {
+        return;
+    }
+
+    // Keep Compact Vertices and Position Dequantization
+    meshData.compactVertices = std::move(compactVertices);
+    meshData.dequantOffset = boundsMin;
+    meshData.dequantScale = extent;
+}
+
+// Weld Exact Duplicate Vertices - Without aiProcess_JoinIdenticalVertices Every Triangle Corner is Its Own Vertex, Leaving No Shared Edges to Collapse or Grow Meshlets Along
+static void weldVertices(sgl::MeshData &meshData) {
+    const std::size_t vertexCount {meshData.vertices.size()};
+    if(vertexCount < 2) return;
+
+    // Sort Vertices Bitwise - Ties Keep Index Order So Every Group Starts With Its First Vertex
+    std::vector<GLuint> sortedVertices(vertexCount);
+    for(GLuint i {0}; i < vertexCount; i++) sortedVertices[i] = i;
+    auto vertexCompare {[&](const GLuint &a, const GLuint &b) {
+        return std::memcmp(&meshData.vertices[a], &meshData.vertices[b], sizeof(sgl::VertexStruct));
+    }};
+    std::sort(sortedVertices.begin(), sortedVertices.end(), [&](const GLuint &a, const GLuint &b) {
+        int order {vertexCompare(a, b)};
+        return order != 0 ? order < 0 : a < b;
+    });
+    std::vector<GLuint> firstVertex(vertexCount);
+    bool hasDuplicates {false};
+    for(std::size_t i {0}, groupStart {0}; i < vertexCount; i++) {
+        if(i > 0 && vertexCompare(sortedVertices[i - 1], sortedVertices[i]) != 0) groupStart = i;
+        firstVertex[sortedVertices[i]] = sortedVertices[groupStart];
+        hasDuplicates |= i != groupStart;
+    }
+    if(!hasDuplicates) return;
+
+    // Compact Vertices in Their Original Order and Remap The Indices
+    std::vector<GLuint> remap(vertexCount);
+    std::size_t weldedCount {0};
+    for(std::size_t i {0}; i < vertexCount; i++) {
+        if(firstVertex[i] == i) {
+            meshData.vertices[weldedCount] = meshData.vertices[i];
+            remap[i] = weldedCount++;
+        } else {
+            remap[i] = remap[firstVertex[i]];
+        }
+    }
+    meshData.vertices.resize(weldedCount);
+    for(GLuint &vertexIndex : meshData.indices) vertexIndex = remap[vertexIndex];
+}
+
+// Bake CPU-Side Mesh Data - Thread-Safe, Doesn't Touch OpenGL
+void sgl::bakeMeshData(sgl::MeshData &meshData, const sgl::ModelBakeSettings &bakeSettings) {
+    // Weld Duplicates Before Simplifying or Clustering - Edge Collapse and Meshlet Growth Only Follow Shared Vertices
+    if(bakeSettings.lodLevels > 0 || bakeSettings.buildMeshlets) {
+        weldVertices(meshData);
+    }
+
+    // Bounding Box
+    glm::vec3 boundsMin {meshData.vertices.empty() ? glm::vec3(0.0f) : meshData.vertices[0].position}, boundsMax {boundsMin};
+    for(const sgl::VertexStruct &vertex : meshData.vertices) {
+        boundsMin = glm::min(boundsMin, vertex.position);
+        boundsMax = glm::max(boundsMax, vertex.position);
+    }
+    meshData.boundingBox.min = boundsMin;
+    meshData.boundingBox.max = boundsMax;
+
+    // Bounding Sphere - Centered on The Bounding Box, Tighter Than Its Half Diagonal
+    meshData.boundingSphere.center = (boundsMin + boundsMax) * 0.5f;
+    float radiusSquared {0.0f};
+    for(const sgl::VertexStruct &vertex : meshData.vertices) {
+        glm::vec3 offset {vertex.position - meshData.boundingSphere.center};
+        radiusSquared = glm::max(radiusSquared, glm::dot(offset, offset));
+    }
+    meshData.boundingSphere.radius = glm::sqrt(radiusSquared);
+
+    // Level of Detail Chain and Meshlets of The Full Detail Level
+    sgl::generateLODs(meshData, bakeSettings);
+    if(bakeSettings.buildMeshlets) {
+        sgl::buildMeshlets(meshData);
+    }
+
+    // Compact Vertices
+    if(bakeSettings.vertexFormat == sgl::VertexFormat::Compact) {
+        bakeCompactVertices(meshData, bakeSettings);
+    }
+}
+
 // Constructor - Create A Mesh Object
-sgl::Mesh::Mesh(const std::vector<sgl::VertexStruct> &vertices, const std::vector<GLuint> &indices, const std::vector<TextureStruct> &textures) {
-    // Initialize Mesh Data
-    this->vertices = vertices;
-    this->indices = indices;
-    this->textures = textures;
+sgl::Mesh::Mesh(std::vector<sgl::VertexStruct> vertices, std::vector<GLuint> indices, std::vector<TextureStruct> textures) : Mesh(std::move(vertices), std::move(indices), std::move(textures), sgl::ModelBakeSettings()) {}
+sgl::Mesh::Mesh(std::vector<sgl::VertexStruct> vertices, std::vector<GLuint> indices, std::vector<TextureStruct> textures, const sgl::ModelBakeSettings &bakeSettings) {
+    // Bake Mesh Data
+    sgl::MeshData meshData;
+    meshData.vertices = std::move(vertices);
+    meshData.indices = std::move(indices);
+    sgl::bakeMeshData(meshData, bakeSettings);
+
+    // Upload Mesh Data
+    this->upload(std::move(meshData), std::move(textures), bakeSettings);
+}
+sgl::Mesh::Mesh(sgl::MeshData meshData, std::vector<TextureStruct> textures, const sgl::ModelBakeSettings &bakeSettings) {
+    this->upload(std::move(meshData), std::move(textures), bakeSettings);
+}
 
-    // Create VAO
-    glGenVertexArrays(1, &this->VAO);
-    glBindVertexArray(this->VAO);
+// Upload Baked Mesh Data to The GPU
+void sgl::Mesh::upload(sgl::MeshData meshData, std::vector<TextureStruct> textures, const sgl::ModelBakeSettings &bakeSettings) {
+    // Initialize Mesh Data - Take Ownership Without Copying
+    this->vertices = std::move(meshData.vertices);
+    this->indices = std::move(meshData.indices);
+    this->textures = std::move(textures);
+    this->boundingBox = meshData.boundingBox;
+    this->boundingSphere = meshData.boundingSphere;
+
+    // Level of Detail Chain - Unbaked Mesh Data Only Has The Full Mesh
+    this->lodLevels = std::move(meshData.lodLevels);
+    if(this->lodLevels.empty()) {
+        this->lodLevels.push_back({0, (GLsizei)this->indices.size(), 0.0f});
+    }
+    this->indexCount = this->lodLevels[0].indexCount;
+
+    // Meshlets and Their Culling Bounds
+    this->meshlets = std::move(meshData.meshlets);
+    for(const sgl::Meshlet &meshlet : this->meshlets) {
+        this->meshletBounds.add(meshlet);
+    }
 
     // Create VBO
     glGenBuffers(1, &this->VBO);
     glBindBuffer(GL_ARRAY_BUFFER, this->VBO);
-    glBufferData(GL_ARRAY_BUFFER, vertices.size() * sizeof(VertexStruct), &vertices[0], GL_STATIC_DRAW);
+    if(!meshData.compactVertices.empty()) {
+        // Upload Compact Vertices and Set Position Dequantization
+        glBufferData(GL_ARRAY_BUFFER, meshData.compactVertices.size() * sizeof(CompactVertexStruct), meshData.compactVertices.data(), GL_STATIC_DRAW);
+        SGL_STAT_ADD(sgl::StatCounter::BufferUploadBytes, meshData.compactVertices.size() * sizeof(CompactVertexStruct));
+        this->vertexFormat = sgl::VertexFormat::Compact;
+        this->dequantOffset = meshData.dequantOffset;
+        this->dequantScale = meshData.dequantScale;
+    } else {
+        glBufferData(GL_ARRAY_BUFFER, this->vertices.size() * sizeof(VertexStruct), this->vertices.data(), GL_STATIC_DRAW);
+        SGL_STAT_ADD(sgl::StatCounter::BufferUploadBytes, this->vertices.size() * sizeof(VertexStruct));
+    }
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
 
-    // Create IBO
+    // Create IBO - Use 16-Bit Indices When Every Vertex Fits
     glGenBuffers(1, &this->IBO);
     glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, this->IBO);
-    glBufferData(GL_ELEMENT_ARRAY_BUFFER, indices.size() * sizeof(unsigned int), &indices[0], GL_STATIC_DRAW);
+    if(this->vertices.size() <= 65536) {
+        std::vector<GLushort> shortIndices(this->indices.begin(), this->indices.end());
+        glBufferData(GL_ELEMENT_ARRAY_BUFFER, shortIndices.size() * sizeof(GLushort), shortIndices.data(), GL_STATIC_DRAW);
+        SGL_STAT_ADD(sgl::StatCounter::BufferUploadBytes, shortIndices.size() * sizeof(GLushort));
+        this->indexType = GL_UNSIGNED_SHORT;
+    } else {
+        glBufferData(GL_ELEMENT_ARRAY_BUFFER, this->indices.size() * sizeof(GLuint), this->indices.data(), GL_STATIC_DRAW);
+        SGL_STAT_ADD(sgl::StatCounter::BufferUploadBytes, this->indices.size() * sizeof(GLuint));
+        this->indexType = GL_UNSIGNED_INT;
+    }
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+
+    // Create VAO Unless It Has to Be Created on Another OpenGL Context
+    if(!bakeSettings.deferVertexArrays) {
+        this->createVertexArray();
+    }
+
+    // Drop CPU-Side Mesh Data if It's Not Needed After Upload
+    if(!bakeSettings.keepCPUData) {
+        this->releaseCPUData();
+    }
+}
+
+// Create VAO on The Current OpenGL Context - Done on Upload Unless Deferred
+void sgl::Mesh::createVertexArray(void) {
+    // VAO Already Created
+    if(this->VAO != 0) return;
+
+    // Create VAO
+    glGenVertexArrays(1, &this->VAO);
+    glBindVertexArray(this->VAO);
+    glBindBuffer(GL_ARRAY_BUFFER, this->VBO);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, this->IBO);
 
     // Vertex Attributes
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(VertexStruct), (void*)0);
-    glEnableVertexAttribArray(0);
-    glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, sizeof(VertexStruct), (void*)offsetof(VertexStruct, normalVector));
-    glEnableVertexAttribArray(1);
-    glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, sizeof(VertexStruct), (void*)offsetof(VertexStruct, textureCoords));
-    glEnableVertexAttribArray(2);
+    if(this->vertexFormat == sgl::VertexFormat::Compact) {
+        glVertexAttribPointer(0, 3, GL_UNSIGNED_SHORT, GL_TRUE, sizeof(CompactVertexStruct), (void*)offsetof(CompactVertexStruct, position));
+        glEnableVertexAttribArray(0);
+        glVertexAttribPointer(1, 2, GL_SHORT, GL_TRUE, sizeof(CompactVertexStruct), (void*)offsetof(CompactVertexStruct, normalVector));
+        glEnableVertexAttribArray(1);
+        glVertexAttribPointer(2, 2, GL_HALF_FLOAT, GL_FALSE, sizeof(CompactVertexStruct), (void*)offsetof(CompactVertexStruct, textureCoords));
+        glEnableVertexAttribArray(2);
+    } else {
+        glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(VertexStruct), (void*)0);
+        glEnableVertexAttribArray(0);
+        glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, sizeof(VertexStruct), (void*)offsetof(VertexStruct, normalVector));
+        glEnableVertexAttribArray(1);
+        glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, sizeof(VertexStruct), (void*)offsetof(VertexStruct, textureCoords));
+        glEnableVertexAttribArray(2);
+    }
 
     // Unbind VAO
     glBindVertexArray(0);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
 }
 
-// Render Mesh Object
+// Render Mesh Object - Draws The Currently Selected Level of Detail
 void sgl::Mesh::render(sgl::Shader &shader) {
+    // Draw The Current Level of Detail Without Touching The Prepared Ranges, Which May Be Recorded Elsewhere
+    const sgl::LODLevel &lodLevel {this->lodLevels[this->currentLOD]};
+    std::size_t indexSize {this->indexType == GL_UNSIGNED_SHORT ? sizeof(GLushort) : sizeof(GLuint)};
+    void* offset {(void*)(lodLevel.firstIndex * indexSize)};
+    this->bind(shader);
+    this->draw(&lodLevel.indexCount, &offset, 1);
+    glBindVertexArray(0);
+}
+
+// Render Only The Meshlets Inside The Frustum and Facing The Camera
+void sgl::Mesh::render(sgl::Shader &shader, const sgl::Frustum &frustum, const glm::vec3 &cameraPosition, sgl::CullStats &cullStats) {
+    if(!this->prepareDraw(frustum, cameraPosition, cullStats)) return;
+    this->bind(shader);
+    this->draw();
+    glBindVertexArray(0);
+}
+
+// Prepare The Current Level of Detail as A Single Index Range
+bool sgl::Mesh::prepareDraw(void) {
+    const sgl::LODLevel &lodLevel {this->lodLevels[this->currentLOD]};
+    std::size_t indexSize {this->indexType == GL_UNSIGNED_SHORT ? sizeof(GLushort) : sizeof(GLuint)};
+    this->drawCounts.assign(1, lodLevel.indexCount);
+    this->drawOffsets.assign(1, (void*)(lodLevel.firstIndex * indexSize));
+    return true;
+}
+
+// Prepare Only The Visible Meshlets - Meshlets Only Cover The Full Detail Level
+bool sgl::Mesh::prepareDraw(const sgl::Frustum &frustum, const glm::vec3 &cameraPosition, sgl::CullStats &cullStats) {
+    if(this->meshlets.empty() || this->currentLOD != 0) {
+        return this->prepareDraw();
+    }
+
+    // Cull Meshlets
+    this->visibleMeshlets.clear();
+    frustum.cullMeshlets(this->meshletBounds, cameraPosition, this->visibleMeshlets);
+    cullStats.clustersVisible += this->visibleMeshlets.size();
+    cullStats.clustersCulled += this->meshlets.size() - this->visibleMeshlets.size();
+
+    // Merge Visible Meshlets That Are Adjacent in The Index Buffer Into Draw Ranges
+    std::size_t indexSize {this->indexType == GL_UNSIGNED_SHORT ? sizeof(GLushort) : sizeof(GLuint)};
+    this->drawCounts.clear();
+    this->drawOffsets.clear();
+    GLuint rangeEnd {0};
+    for(unsigned int meshletIndex : this->visibleMeshlets) {
+        const sgl::Meshlet &meshlet {this->meshlets[meshletIndex]};
+        if(!this->drawCounts.empty() && meshlet.firstIndex == rangeEnd) {
+            this->drawCounts.back() += meshlet.indexCount;
+        } else {
+            this->drawCounts.push_back(meshlet.indexCount);
+            this->drawOffsets.push_back((void*)(meshlet.firstIndex * indexSize));
+        }
+        rangeEnd = meshlet.firstIndex + meshlet.indexCount;
+    }
+    return !this->drawCounts.empty();
+}
+
+// Draw The Prepared Index Ranges - All at Once When There Are Several
+void sgl::Mesh::draw(void) {
+    this->draw(this->drawCounts.data(), this->drawOffsets.data(), this->drawCounts.size());
+}
+void sgl::Mesh::draw(const GLsizei* counts, void* const* offsets, const GLsizei &rangeCount) {
+    if(rangeCount == 1) {
+        glDrawElements(GL_TRIANGLES, counts[0], this->indexType, offsets[0]);
+    } else if(rangeCount > 1) {
+        glMultiDrawElements(GL_TRIANGLES, counts, this->indexType, offsets, rangeCount);
+    }
+
+    // Stats - A Multi-Draw Counts as One Draw Call
+    if(rangeCount > 0 && sgl::isStatsEnabled()) {
+        GLsizei indexCount {0};
+        for(GLsizei i {0}; i < rangeCount; i++) indexCount += counts[i];
+        SGL_STAT_ADD(sgl::StatCounter::DrawCallCount, 1);
+        SGL_STAT_ADD(sgl::StatCounter::TriangleCount, indexCount / 3);
+    }
+}
+
+// Select The Coarsest Level of Detail Whose Projected Error Stays Under maxPixelError
+void sgl::Mesh::selectLOD(const glm::vec3 &viewPosition, const float &projectionScale, const float &maxPixelError) {
+    // Switching Margin - Levels Only Change Once Their Error is Clearly Past The Threshold So They Don't Flicker at The Boundary
+    const float lodHysteresis {0.2f};
+
+    // Projected Error of A Level in Pixels at The Distance of The Bounding Sphere's Nearest Point
+    float distance {glm::max(glm::length(viewPosition - this->boundingSphere.center) - this->boundingSphere.radius, 1e-4f)};
+    auto projectedError {[&](const unsigned int &level) {return this->lodLevels[level].error * projectionScale / distance;}};
+
+    // Coarsest Level Within The Error Budget - Errors Never Decrease Down The Chain
+    unsigned int desiredLOD {0};
+    while(desiredLOD + 1 < this->lodLevels.size() && projectedError(desiredLOD + 1) <= maxPixelError) desiredLOD++;
+
+    // Coarsen Only Once Comfortably Under The Threshold, Refine Only Once Clearly Over It
+    if(desiredLOD > this->currentLOD) {
+        while(desiredLOD > this->currentLOD && projectedError(desiredLOD) > maxPixelError * (1.0f - lodHysteresis)) desiredLOD--;
+        this->currentLOD = desiredLOD;
+    } else if(desiredLOD < this->currentLOD && projectedError(this->currentLOD) > maxPixelError * (1.0f + lodHysteresis)) {
+        this->currentLOD = desiredLOD;
+    }
+}
+
+// Bind Mesh Textures, Vertex Decoding Uniforms and VAO For Drawing
+void sgl::Mesh::bind(sgl::Shader &shader) {
+    this->bindTextures(shader);
+    this->bindVertexArray(shader);
+}
+void sgl::Mesh::bindTextures(sgl::Shader &shader) {
     unsigned int diffuseNr {1}, specularNr {1};
     for(unsigned int i {0}; i < this->textures.size(); i++) {
         glActiveTexture(GL_TEXTURE0 + i);
@@ -49,11 +379,17 @@ void sgl::Mesh::render(sgl::Shader &shader) {
         glBindTexture(GL_TEXTURE_2D, this->textures[i].id);
     }
     glActiveTexture(GL_TEXTURE0);
+    SGL_STAT_ADD(sgl::StatCounter::TextureBindCount, this->textures.size());
+}
+void sgl::Mesh::bindVertexArray(sgl::Shader &shader) {
+    // Vertex Decoding Uniforms
+    shader.setVec3("dequantOffset", this->dequantOffset);
+    shader.setVec3("dequantScale", this->dequantScale);
+    shader.setBool("octahedralNormals", this->vertexFormat == sgl::VertexFormat::Compact);
 
-    // Render Mesh
+    // Bind VAO
     glBindVertexArray(this->VAO);
-    glDrawElements(GL_TRIANGLES, this->indices.size(), GL_UNSIGNED_INT, nullptr);
-    glBindVertexArray(0);
+    SGL_STAT_ADD(sgl::StatCounter::StateChangeCount, 1);
 }
 
 // Destroy Mesh
@@ -69,8 +405,42 @@ void sgl::Mesh::destroy(void) {
     }
 }
 
+// Release CPU-Side Vertices and Indices - GPU Buffers Stay Intact
+void sgl::Mesh::releaseCPUData(void) {
+    std::vector<sgl::VertexStruct>().swap(this->vertices);
+    std::vector<GLuint>().swap(this->indices);
+}
+
+// Getters
+sgl::VertexFormat sgl::Mesh::getVertexFormat(void) {return this->vertexFormat;}
+GLenum sgl::Mesh::getIndexType(void) {return this->indexType;}
+GLsizei sgl::Mesh::getIndexCount(void) {return this->indexCount;}
+const std::vector<sgl::LODLevel>& sgl::Mesh::getLODLevels(void) {return this->lodLevels;}
+const std::vector<sgl::Meshlet>& sgl::Mesh::getMeshlets(void) {return this->meshlets;}
+unsigned int sgl::Mesh::getCurrentLOD(void) {return this->currentLOD;}
+const std::vector<GLsizei>& sgl::Mesh::getDrawCounts(void) {return this->drawCounts;}
+const std::vector<void*>& sgl::Mesh::getDrawOffsets(void) {return this->drawOffsets;}
+GLuint sgl::Mesh::getVertexArray(void) {return this->VAO;}
+GLuint sgl::Mesh::getMaterialID(void) {
+    // FNV-1a Hash of The Texture Set - 0 For Untextured Meshes
+    if(this->textures.empty()) return 0;
+    GLuint materialID {2166136261u};
+    for(const sgl::TextureStruct &texture : this->textures) {
+        materialID = (materialID ^ texture.id) * 16777619u;
+    }
+    return materialID;
+}
+const sgl::BoundingBox& sgl::Mesh::getBoundingBox(void) {return this->boundingBox;}
+const sgl::BoundingSphere& sgl::Mesh::getBoundingSphere(void) {return this->boundingSphere;}
+
 // Constructor - Load Model File
-sgl::Model::Model(const std::string &modelFilePath, const unsigned int &processFlags) {
+sgl::Model::Model(const std::string &modelFilePath, const unsigned int &processFlags) : Model(modelFilePath, processFlags, sgl::ModelBakeSettings()) {}
+sgl::Model::Model(const std::string &modelFilePath, const unsigned int &processFlags, const sgl::ModelBakeSettings &bakeSettings) {
+    SGL_PROFILE_SCOPE("Model::Model");
+
+    // Set Bake Settings
+    this->bakeSettings = bakeSettings;
+
     // Import Model File
     Assimp::Importer importer;
     const aiScene* scene {importer.ReadFile(modelFilePath, processFlags)};
@@ -84,90 +454,203 @@ sgl::Model::Model(const std::string &modelFilePath, const unsigned int &processF
     // Retrieve Full Path to Model File
     this->directory = modelFilePath.substr(0, modelFilePath.find_last_of('/'));
 
-    // Process All The Nodes in The Model
-    this->processNode(scene->mRootNode, scene);
+    // Flatten The Node Tree Into A Mesh Work List
+    std::vector<aiMesh*> workList;
+    this->processNode(scene->mRootNode, scene, workList);
+
+    // Convert and Bake All The Meshes on Worker Threads Into CPU-Side Mesh Data
+    std::vector<std::vector<sgl::MeshData>> meshData(workList.size());
+    if(this->bakeSettings.jobSystem != nullptr) {
+        // One Job Per Mesh - Meshes Vary Wildly in Size So Stealing Balances The Work
+        this->bakeSettings.jobSystem->parallelFor(workList.size(), 1, [&](const std::size_t &begin, const std::size_t &end) {
+            for(std::size_t i {begin}; i < end; i++) {
+                this->processMesh(workList[i], meshData[i]);
+            }
+        });
+    } else {
+        std::atomic<std::size_t> nextMesh {0};
+        auto bakeWorker {[&](void) {
+            for(std::size_t i {nextMesh++}; i < workList.size(); i = nextMesh++) {
+                this->processMesh(workList[i], meshData[i]);
+            }
+        }};
+        unsigned int threadCount {this->bakeSettings.bakeThreads > 0 ? this->bakeSettings.bakeThreads : std::max(std::thread::hardware_concurrency(), 1u)};
+        threadCount = std::min<std::size_t>(threadCount, workList.size());
+        std::vector<std::thread> bakeThreads;
+        for(unsigned int i {1}; i < threadCount; i++) {
+            bakeThreads.emplace_back(bakeWorker);
+        }
+        bakeWorker();
+        for(std::thread &bakeThread : bakeThreads) {
+            bakeThread.join();
+        }
+    }
+
+    // Upload All The Meshes on The Render Context Thread in One Batch
+    this->uploadMeshes(scene, workList, meshData);
+
+    // Without CPU-Side Copies Nothing of The Import is Left - Free The Scene Now and Hand The Freed Heap Back, glibc Keeps It Resident Otherwise
+    if(!this->bakeSettings.keepCPUData) {
+        importer.FreeScene();
+#if defined(__GLIBC__)
+        malloc_trim(0);
+#endif
+    }
 }
 
-// Process All The Nodes/Meshes in The Model
-void sgl::Model::processNode(aiNode* node, const aiScene* scene) {
-    // Process All The Node's Meshes if Any
+// Process All The Nodes/Meshes in The Model - Flattens The Node Tree Into A Mesh Work List
+void sgl::Model::processNode(aiNode* node, const aiScene* scene, std::vector<aiMesh*> &workList) {
+    // Add All The Node's Meshes if Any
     for(unsigned int i {0}; i < node->mNumMeshes; i++) {
-        aiMesh* mesh {scene->mMeshes[node->mMeshes[i]]};
-        this->meshes.push_back(this->processMesh(mesh, scene));
+        workList.push_back(scene->mMeshes[node->mMeshes[i]]);
     }
 
     // Process All The Child Nodes if Any
     for(unsigned int i {0}; i < node->mNumChildren; i++) {
-        this->processNode(node->mChildren[i], scene);
+        this->processNode(node->mChildren[i], scene, workList);
     }
 }
-sgl::Mesh sgl::Model::processMesh(aiMesh* mesh, const aiScene* scene) {
+
+// Split A Triangle Mesh Into Chunks of At Most 65536 Unique Vertices So Each Chunk Can Use 16-Bit Indices
+static void splitFor16BitIndices(const sgl::MeshData &meshData, std::vector<sgl::MeshData> &chunks) {
+    const std::size_t maxChunkVertices {65536};
+    std::vector<GLuint> remap(meshData.vertices.size(), UINT32_MAX);
+    std::vector<GLuint> usedVertices;
+
+    // Start A New Chunk
+    chunks.emplace_back();
+    for(std::size_t i {0}; i + 2 < meshData.indices.size(); i += 3) {
+        // Count The Triangle's Vertices Not Yet in The Current Chunk
+        unsigned int newVertices {0};
+        for(std::size_t j {0}; j < 3; j++) {
+            if(remap[meshData.indices[i + j]] == UINT32_MAX) newVertices++;
+        }
+
+        // Flush Current Chunk if The Triangle Doesn't Fit
+        if(chunks.back().vertices.size() + newVertices > maxChunkVertices) {
+            for(GLuint vertexIndex : usedVertices) remap[vertexIndex] = UINT32_MAX;
+            usedVertices.clear();
+            chunks.emplace_back();
+        }
+
+        // Add Triangle to Current Chunk
+        sgl::MeshData &chunk {chunks.back()};
+        for(std::size_t j {0}; j < 3; j++) {
+            GLuint vertexIndex {meshData.indices[i + j]};
+            if(remap[vertexIndex] == UINT32_MAX) {
+                remap[vertexIndex] = chunk.vertices.size();
+                chunk.vertices.push_back(meshData.vertices[vertexIndex]);
+                usedVertices.push_back(vertexIndex);
+            }
+            chunk.indices.push_back(remap[vertexIndex]);
+        }
+    }
+}
+
+// Convert and Bake A Mesh Into CPU-Side Mesh Data - Runs on Worker Threads, Mustn't Touch OpenGL
+void sgl::Model::processMesh(aiMesh* mesh, std::vector<sgl::MeshData> &meshData) {
+    SGL_PROFILE_SCOPE("Model::processMesh");
+
     // Mesh Data
-    std::vector<sgl::VertexStruct> vertices;
-    std::vector<GLuint> indices;
-    std::vector<sgl::TextureStruct> textures;
+    sgl::MeshData data;
+    std::vector<sgl::VertexStruct> &vertices {data.vertices};
+    std::vector<GLuint> &indices {data.indices};
 
-    // Process All The Mesh Vertices
+    // Process All The Mesh Vertices - One Strided Pass Per Attribute With Branches Hoisted Out of The Loops
+    vertices.resize(mesh->mNumVertices);
+    static_assert(sizeof(aiVector3D) == sizeof(glm::vec3), "aiVector3D Must Match glm::vec3 For Bulk Conversion");
     for(unsigned int i {0}; i < mesh->mNumVertices; i++) {
-        sgl::VertexStruct vertex;
-
-        // Vertex Positions
-        vertex.position.x = mesh->mVertices[i].x;
-        vertex.position.y = mesh->mVertices[i].y;
-        vertex.position.z = mesh->mVertices[i].z;
-
-        // Normal Vectors if Any
-        if(mesh->HasNormals()) {
-            vertex.normalVector.x = mesh->mNormals[i].x;
-            vertex.normalVector.y = mesh->mNormals[i].y;
-            vertex.normalVector.z = mesh->mNormals[i].z;
-        } else {
-            vertex.normalVector = glm::vec3(0.0f);
-        }
+        std::memcpy(&vertices[i].position, &mesh->mVertices[i], sizeof(glm::vec3));
+    }
 
-        // Texture Coordinates if Any
-        if(mesh->mTextureCoords[0]) {
-            vertex.textureCoords.x = mesh->mTextureCoords[0][i].x;
-            vertex.textureCoords.y = mesh->mTextureCoords[0][i].y;
-        } else {
-            vertex.textureCoords = glm::vec2(0.0f);
+    // Normal Vectors if Any
+    if(mesh->HasNormals()) {
+        for(unsigned int i {0}; i < mesh->mNumVertices; i++) {
+            std::memcpy(&vertices[i].normalVector, &mesh->mNormals[i], sizeof(glm::vec3));
         }
+    } else {
+        for(sgl::VertexStruct &vertex : vertices) vertex.normalVector = glm::vec3(0.0f);
+    }
 
-        vertices.push_back(vertex);
+    // Texture Coordinates if Any
+    if(mesh->mTextureCoords[0]) {
+        for(unsigned int i {0}; i < mesh->mNumVertices; i++) {
+            std::memcpy(&vertices[i].textureCoords, &mesh->mTextureCoords[0][i], sizeof(glm::vec2));
+        }
+    } else {
+        for(sgl::VertexStruct &vertex : vertices) vertex.textureCoords = glm::vec2(0.0f);
     }
 
-    // Process All The Mesh Indices
+    // Process All The Mesh Indices - Reserve For Triangulated Faces
+    indices.reserve(mesh->mNumFaces * 3);
     for(unsigned int i {0}; i < mesh->mNumFaces; i++) {
-        aiFace face {mesh->mFaces[i]};
-        for(unsigned int j {0}; j < face.mNumIndices; j++) {
-            indices.push_back(face.mIndices[j]);
-        }
+        const aiFace &face {mesh->mFaces[i]};
+        indices.insert(indices.end(), face.mIndices, face.mIndices + face.mNumIndices);
     }
 
-    // Process All The Mesh Materials/Textures if Any
-    if(mesh->mMaterialIndex >= 0) {
-        aiMaterial* material {scene->mMaterials[mesh->mMaterialIndex]};
-        
-        std::vector<sgl::TextureStruct> diffuseMaps {this->loadMaterialTextures(material, aiTextureType_DIFFUSE, "texture_diffuse")};
-        textures.insert(textures.end(), diffuseMaps.begin(), diffuseMaps.end());
-        
-        std::vector<sgl::TextureStruct> specularMaps {this->loadMaterialTextures(material, aiTextureType_SPECULAR, "texture_specular")};
-        textures.insert(textures.end(), specularMaps.begin(), specularMaps.end());
+    // Split Large Meshes to Fit 16-Bit Indices if Requested
+    if(this->bakeSettings.splitFor16BitIndices && vertices.size() > 65536) {
+        splitFor16BitIndices(data, meshData);
+    } else {
+        meshData.push_back(std::move(data));
     }
 
-    // Return Mesh Object
-    return sgl::Mesh(vertices, indices, textures);
+    // Bake All The Mesh Data
+    for(sgl::MeshData &chunk : meshData) {
+        sgl::bakeMeshData(chunk, this->bakeSettings);
+    }
+}
+
+// Upload All The Baked Meshes and Load Their Materials/Textures - Runs on The Render Context Thread
+void sgl::Model::uploadMeshes(const aiScene* scene, const std::vector<aiMesh*> &workList, std::vector<std::vector<sgl::MeshData>> &meshData) {
+    SGL_PROFILE_SCOPE("Model::uploadMeshes");
+
+    std::size_t meshCount {0};
+    for(const std::vector<sgl::MeshData> &chunks : meshData) {
+        meshCount += chunks.size();
+    }
+    this->meshes.reserve(meshCount);
+
+    for(std::size_t i {0}; i < workList.size(); i++) {
+        // Process All The Mesh Materials/Textures if Any
+        std::vector<sgl::TextureStruct> textures;
+        if(workList[i]->mMaterialIndex < scene->mNumMaterials) {
+            aiMaterial* material {scene->mMaterials[workList[i]->mMaterialIndex]};
+
+            std::vector<sgl::TextureStruct> diffuseMaps {this->loadMaterialTextures(material, aiTextureType_DIFFUSE, "texture_diffuse")};
+            textures.insert(textures.end(), diffuseMaps.begin(), diffuseMaps.end());
+
+            std::vector<sgl::TextureStruct> specularMaps {this->loadMaterialTextures(material, aiTextureType_SPECULAR, "texture_specular")};
+            textures.insert(textures.end(), specularMaps.begin(), specularMaps.end());
+        }
+
+        // Create Mesh Objects
+        for(sgl::MeshData &chunk : meshData[i]) {
+            this->meshBounds.add(chunk.boundingBox);
+            this->meshes.emplace_back(std::move(chunk), textures, this->bakeSettings);
+        }
+    }
+
+    // Build Mesh BVH
+    std::vector<sgl::BoundingBox> meshBoxes;
+    meshBoxes.reserve(this->meshes.size());
+    for(sgl::Mesh &mesh : this->meshes) {
+        meshBoxes.push_back(mesh.getBoundingBox());
+    }
+    this->meshBVH.build(meshBoxes);
 }
 
 // Load A 2D Texture Image File
 GLuint load2DTex(const std::string &texImgFilePath) {
+    SGL_PROFILE_SCOPE("load2DTex");
+
     // Create A Texture Object
     GLuint texture;
     glGenTextures(1, &texture);
     glBindTexture(GL_TEXTURE_2D, texture);
 
-    // Flip Texture Images Vertically Upon Loading Them
-    stbi_set_flip_vertically_on_load(true);
+    // Flip Texture Images Vertically Upon Loading Them - Per Thread as Models May Be Loaded in The Background
+    stbi_set_flip_vertically_on_load_thread(true);
 
     // Load 2D Texture Image File
     int texImgWidth, texImgHeight, texImgNrChannels;
@@ -245,6 +728,187 @@ void sgl::Model::render(sgl::Shader &shader) {
     }
 }
 
+void sgl::Model::render(sgl::Shader &shader, const sgl::Frustum &frustum, sgl::CullStats &cullStats) {
+    // Render Visible Meshes
+    this->cullMeshes(frustum, cullStats);
+    for(unsigned int meshIndex : this->visibleMeshes) {
+        this->meshes[meshIndex].render(shader);
+    }
+}
+void sgl::Model::render(sgl::Shader &shader, const sgl::Frustum &frustum, const glm::vec3 &cameraPosition, sgl::CullStats &cullStats) {
+    // Render Visible Meshes - Each Also Culls Its Meshlets
+    this->cullMeshes(frustum, cullStats);
+    for(unsigned int meshIndex : this->visibleMeshes) {
+        this->meshes[meshIndex].render(shader, frustum, cameraPosition, cullStats);
+    }
+}
+
+// Record Draws of The Visible Meshes in A Mesh Range - Only Touches The Range's Meshes and The Command Buffer, Never OpenGL
+void sgl::Model::record(sgl::CommandBuffer &commandBuffer, sgl::Shader &shader, const glm::mat4 &projectionViewMatrix, const glm::mat4 &modelMatrix, const glm::vec3 &cameraPosition, const std::size_t &firstMesh, const std::size_t &meshCount, sgl::CullStats &cullStats) {
+    glm::mat4 pvm {projectionViewMatrix * modelMatrix};
+    sgl::Frustum frustum(pvm);
+    glm::vec3 modelSpaceCameraPosition {glm::inverse(modelMatrix) * glm::vec4(cameraPosition, 1.0f)};
+
+    // Every Replayed Buffer Starts With Its Own Shader State
+    commandBuffer.useShader(shader);
+    commandBuffer.setMat4(shader, "pvm", pvm);
+
+    // Cull and Record Meshes - Textures Are Only Rebound When The Material Changes
+    bool materialBound {false};
+    GLuint currentMaterial {0};
+    for(std::size_t i {firstMesh}; i < std::min(firstMesh + meshCount, this->meshes.size()); i++) {
+        sgl::Mesh &mesh {this->meshes[i]};
+        if(!frustum.testBox(mesh.getBoundingBox())) {
+            cullStats.culled++;
+            continue;
+        }
+        cullStats.visible++;
+        if(!mesh.prepareDraw(frustum, modelSpaceCameraPosition, cullStats)) continue;
+
+        if(!materialBound || mesh.getMaterialID() != currentMaterial) {
+            commandBuffer.bindTextures(mesh, shader);
+            currentMaterial = mesh.getMaterialID();
+            materialBound = true;
+        }
+        commandBuffer.bindVertexArray(mesh, shader);
+        commandBuffer.draw(mesh);
+    }
+}
+
+// Record All The Meshes Split Into One Chunk Per Command Buffer as Parallel Jobs
+void sgl::Model::recordParallel(sgl::JobSystem &jobSystem, std::vector<sgl::CommandBuffer> &commandBuffers, sgl::Shader &shader, const glm::mat4 &projectionViewMatrix, const glm::mat4 &modelMatrix, const glm::vec3 &cameraPosition, sgl::CullStats &cullStats) {
+    if(commandBuffers.empty()) return;
+
+    // Contiguous Chunks Keep The Replayed Draw Order Identical to Recording on One Thread
+    const std::size_t chunkSize {(this->meshes.size() + commandBuffers.size() - 1) / commandBuffers.size()};
+    std::vector<sgl::CullStats> chunkStats(commandBuffers.size());
+    jobSystem.parallelFor(commandBuffers.size(), 1, [&](const std::size_t &begin, const std::size_t &end) {
+        for(std::size_t chunk {begin}; chunk < end; chunk++) {
+            commandBuffers[chunk].reset();
+            this->record(commandBuffers[chunk], shader, projectionViewMatrix, modelMatrix, cameraPosition, chunk * chunkSize, chunkSize, chunkStats[chunk]);
+        }
+    });
+
+    // Merge Culling Stats
+    for(const sgl::CullStats &stats : chunkStats) {
+        cullStats.visible += stats.visible;
+        cullStats.culled += stats.culled;
+        cullStats.clustersVisible += stats.clustersVisible;
+        cullStats.clustersCulled += stats.clustersCulled;
+    }
+}
+
+// Submit Visible Meshes to A Render Queue - Meshlets Are Culled Now, The Queue Only Draws The Prepared Ranges
+void sgl::Model::submit(sgl::RenderQueue &renderQueue, const sgl::RenderPass &pass, sgl::Shader &shader, const glm::mat4 &projectionViewMatrix, const glm::mat4 &modelMatrix, const glm::vec3 &cameraPosition, sgl::CullStats &cullStats) {
+    glm::mat4 pvm {projectionViewMatrix * modelMatrix};
+    sgl::Frustum frustum(pvm);
+    glm::vec3 modelSpaceCameraPosition {glm::inverse(modelMatrix) * glm::vec4(cameraPosition, 1.0f)};
+
+    this->cullMeshes(frustum, cullStats);
+    for(unsigned int meshIndex : this->visibleMeshes) {
+        sgl::Mesh &mesh {this->meshes[meshIndex]};
+        if(!mesh.prepareDraw(frustum, modelSpaceCameraPosition, cullStats)) continue;
+        glm::vec3 center {modelMatrix * glm::vec4(mesh.getBoundingSphere().center, 1.0f)};
+        renderQueue.submit(pass, mesh, shader, pvm, glm::length(center - cameraPosition));
+    }
+}
+
+void sgl::Model::submit(sgl::JobSystem &jobSystem, sgl::RenderQueue &renderQueue, const sgl::RenderPass &pass, sgl::Shader &shader, const glm::mat4 &projectionViewMatrix, const glm::mat4 &modelMatrix, const glm::vec3 &cameraPosition, sgl::CullStats &cullStats) {
+    const std::size_t prepareGrainSize {16};
+    glm::mat4 pvm {projectionViewMatrix * modelMatrix};
+    sgl::Frustum frustum(pvm);
+    glm::vec3 modelSpaceCameraPosition {glm::inverse(modelMatrix) * glm::vec4(cameraPosition, 1.0f)};
+
+    // Prepare Visible Meshes in Parallel - Each Mesh Only Touches Its Own Draw Ranges
+    this->cullMeshes(frustum, cullStats);
+    const std::size_t chunkCount {(this->visibleMeshes.size() + prepareGrainSize - 1) / prepareGrainSize};
+    std::vector<sgl::CullStats> chunkStats(chunkCount);
+    std::vector<std::uint8_t> prepared(this->visibleMeshes.size(), 0);
+    jobSystem.parallelFor(this->visibleMeshes.size(), prepareGrainSize, [&](const std::size_t &begin, const std::size_t &end) {
+        sgl::CullStats &stats {chunkStats[begin / prepareGrainSize]};
+        for(std::size_t i {begin}; i < end; i++) {
+            prepared[i] = this->meshes[this->visibleMeshes[i]].prepareDraw(frustum, modelSpaceCameraPosition, stats);
+        }
+    });
+
+    // Merge Culling Stats
+    for(const sgl::CullStats &stats : chunkStats) {
+        cullStats.clustersVisible += stats.clustersVisible;
+        cullStats.clustersCulled += stats.clustersCulled;
+    }
+
+    // Queue Prepared Meshes
+    for(std::size_t i {0}; i < this->visibleMeshes.size(); i++) {
+        if(!prepared[i]) continue;
+        sgl::Mesh &mesh {this->meshes[this->visibleMeshes[i]]};
+        glm::vec3 center {modelMatrix * glm::vec4(mesh.getBoundingSphere().center, 1.0f)};
+        renderQueue.submit(pass, mesh, shader, pvm, glm::length(center - cameraPosition));
+    }
+}
+
+// Cull Mesh Bounding Boxes Against The Frustum - Through The BVH For Models With Many Meshes
+void sgl::Model::cullMeshes(const sgl::Frustum &frustum, sgl::CullStats &cullStats) {
+    const std::size_t bvhCullingMinMeshes {64};
+    this->visibleMeshes.clear();
+    if(this->meshes.size() >= bvhCullingMinMeshes) {
+        this->meshBVH.cullFrustum(frustum, this->visibleMeshes);
+    } else {
+        frustum.cullBoxes(this->meshBounds, this->visibleMeshes);
+    }
+    cullStats.visible += this->visibleMeshes.size();
+    cullStats.culled += this->meshes.size() - this->visibleMeshes.size();
+}
+
+// Ray Query in Model Space - Picks The Nearest Mesh, Triangle Accurate if CPU-Side Mesh Data Was Kept
+bool sgl::Model::raycast(const glm::vec3 &origin, const glm::vec3 &direction, sgl::RayHit &hit) {
+    return this->meshBVH.raycast(origin, direction, hit, [&](const unsigned int &meshIndex, float &distance) {
+        // Only Bounding Boxes Are Available Without CPU-Side Mesh Data
+        sgl::Mesh &mesh {this->meshes[meshIndex]};
+        if(mesh.vertices.empty()) return true;
+
+        // Moller-Trumbore Ray/Triangle Intersection Against Every Triangle of The Full Detail Level
+        float closestDistance {std::numeric_limits<float>::infinity()};
+        const std::size_t fullDetailIndices {(std::size_t)mesh.getIndexCount()};
+        for(std::size_t i {0}; i + 2 < fullDetailIndices; i += 3) {
+            const glm::vec3 &v0 {mesh.vertices[mesh.indices[i]].position};
+            glm::vec3 edge1 {mesh.vertices[mesh.indices[i + 1]].position - v0}, edge2 {mesh.vertices[mesh.indices[i + 2]].position - v0};
+            glm::vec3 p {glm::cross(direction, edge2)};
+            float determinant {glm::dot(edge1, p)};
+            if(glm::abs(determinant) < 1e-8f) continue;
+            float inverseDeterminant {1.0f / determinant};
+            glm::vec3 t {origin - v0};
+            float u {glm::dot(t, p) * inverseDeterminant};
+            if(u < 0.0f || u > 1.0f) continue;
+            glm::vec3 q {glm::cross(t, edge1)};
+            float v {glm::dot(direction, q) * inverseDeterminant};
+            if(v < 0.0f || u + v > 1.0f) continue;
+            float triangleDistance {glm::dot(edge2, q) * inverseDeterminant};
+            if(triangleDistance >= 0.0f && triangleDistance < closestDistance) closestDistance = triangleDistance;
+        }
+        if(closestDistance == std::numeric_limits<float>::infinity()) return false;
+        distance = closestDistance;
+        return true;
+    });
+}
+
+// Select Every Mesh's Level of Detail From Its Projected Screen-Space Error
+void sgl::Model::selectLODs(const glm::vec3 &cameraPosition, const float &fovDegrees, const float &viewportHeight, const float &maxPixelError) {
+    float projectionScale {viewportHeight / (2.0f * glm::tan(glm::radians(fovDegrees) * 0.5f))};
+    for(unsigned int i {0}; i < this->meshes.size(); i++) {
+        this->meshes[i].selectLOD(cameraPosition, projectionScale, maxPixelError);
+    }
+}
+
+// Create Deferred VAOs For All The Meshes on The Current OpenGL Context
+void sgl::Model::createVertexArrays(void) {
+    for(unsigned int i {0}; i < this->meshes.size(); i++) {
+        this->meshes[i].createVertexArray();
+    }
+}
+
+// Getters
+std::vector<sgl::Mesh>& sgl::Model::getMeshes(void) {return this->meshes;}
+
 // Destroy Model - Destroys All The Meshes
 void sgl::Model::destroy(void) {
     for(unsigned int i {0}; i < this->meshes.size(); i++) {
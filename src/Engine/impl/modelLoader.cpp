@@ -0,0 +1,130 @@
+#include"../Engine.hpp"
+
+// Model Load Request - Shared Between The Loader Thread and The Model Handle
+struct sgl::ModelLoadRequest {
+    // Model File and Bake Settings
+    std::string modelFilePath;
+    unsigned int processFlags;
+    sgl::ModelBakeSettings bakeSettings;
+
+    // Loaded Model and Fence Signaled Once All Its Uploads Have Completed
+    std::unique_ptr<sgl::Model> model;
+    GLsync uploadFence {nullptr};
+    std::atomic<bool> uploaded {false};
+
+    // Whether The Model Was Finalized on The Render Thread
+    bool resident {false};
+};
+
+// Check if The Model is Resident - Polls The Upload Fence and Finalizes The Model on The Calling (Render) Thread Once Signaled
+bool sgl::ModelHandle::isResident(void) {
+    // No Request or Already Resident
+    if(!this->request) return false;
+    if(this->request->resident) return true;
+
+    // Loader Thread Hasn't Finished Yet
+    if(!this->request->uploaded.load(std::memory_order_acquire)) return false;
+
+    // Poll Upload Fence Without Blocking
+    GLenum fenceStatus {glClientWaitSync(this->request->uploadFence, 0, 0)};
+    if(fenceStatus != GL_ALREADY_SIGNALED && fenceStatus != GL_CONDITION_SATISFIED) return false;
+    glDeleteSync(this->request->uploadFence);
+    this->request->uploadFence = nullptr;
+
+    // Create The Model's VAOs on This Context - VAOs Aren't Shared Between Contexts
+    this->request->model->createVertexArrays();
+    this->request->resident = true;
+    return true;
+}
+
+// Get Loaded Model - Only Valid Once Resident
+sgl::Model& sgl::ModelHandle::get(void) {return *this->request->model;}
+
+// Constructor - Create A Hidden Window Sharing The Main Window's OpenGL Context and Start The Loader Thread
+sgl::ModelLoader::ModelLoader(GLFWwindow* sharedWin) {
+    // Create Hidden Window - Inherits The Context Hints of The Main Window
+    glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+    this->loaderWin = glfwCreateWindow(1, 1, "SGL Model Loader", nullptr, sharedWin);
+    glfwWindowHint(GLFW_VISIBLE, GLFW_TRUE);
+    if(this->loaderWin == nullptr) {
+        // Display Error Message
+        std::cerr << "Failed to Create Model Loader OpenGL Context!" << std::endl;
+        return;
+    }
+
+    // Start Loader Thread
+    this->loaderThread = std::thread(&sgl::ModelLoader::loaderMain, this);
+}
+
+// Queue A Model to Be Loaded in The Background
+sgl::ModelHandle sgl::ModelLoader::load(const std::string &modelFilePath, const unsigned int &processFlags, const sgl::ModelBakeSettings &bakeSettings) {
+    // Create Load Request - VAOs Are Created Later on The Render Thread
+    std::shared_ptr<sgl::ModelLoadRequest> request {std::make_shared<sgl::ModelLoadRequest>()};
+    request->modelFilePath = modelFilePath;
+    request->processFlags = processFlags;
+    request->bakeSettings = bakeSettings;
+    request->bakeSettings.deferVertexArrays = true;
+
+    // Queue Load Request
+    if(this->loaderWin != nullptr) {
+        std::lock_guard<std::mutex> lock(this->queueMutex);
+        this->queue.push_back(request);
+    } else {
+        std::cerr << "Model Loader Has No OpenGL Context! " << modelFilePath << std::endl;
+    }
+    this->queueCondition.notify_one();
+
+    // Return Model Handle
+    sgl::ModelHandle handle;
+    handle.request = request;
+    return handle;
+}
+
+// Loader Thread Main Loop
+void sgl::ModelLoader::loaderMain(void) {
+    // Make The Loader's OpenGL Context Current on This Thread
+    glfwMakeContextCurrent(this->loaderWin);
+    sgl::setTraceThreadName("Model Loader");
+
+    while(true) {
+        // Wait For A Load Request
+        std::shared_ptr<sgl::ModelLoadRequest> request;
+        {
+            std::unique_lock<std::mutex> lock(this->queueMutex);
+            this->queueCondition.wait(lock, [this](void) {return this->stopping || !this->queue.empty();});
+            if(this->stopping) break;
+            request = this->queue.front();
+            this->queue.pop_front();
+        }
+
+        // Import Model, Decode Textures and Upload Buffers
+        request->model = std::make_unique<sgl::Model>(request->modelFilePath, request->processFlags, request->bakeSettings);
+
+        // Insert Fence and Flush So The Render Thread Can Wait on The Uploads
+        request->uploadFence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        glFlush();
+        request->uploaded.store(true, std::memory_order_release);
+    }
+
+    // Release The Loader's OpenGL Context
+    glfwMakeContextCurrent(nullptr);
+}
+
+// Destroy Model Loader - Stops The Loader Thread and Destroys The Hidden Window, Must Be Called on The Main Thread
+void sgl::ModelLoader::destroy(void) {
+    // Stop Loader Thread
+    {
+        std::lock_guard<std::mutex> lock(this->queueMutex);
+        this->stopping = true;
+    }
+    this->queueCondition.notify_one();
+    if(this->loaderThread.joinable()) {
+        this->loaderThread.join();
+    }
+
+    // Destroy Hidden Window
+    if(this->loaderWin != nullptr) {
+        glfwDestroyWindow(this->loaderWin);
+        this->loaderWin = nullptr;
+    }
+}
@@ -0,0 +1,431 @@
+#include"../Engine.hpp"
+
+// Effect Source File, Whether It Reads Neighboring Pixels and How The Generated Main Applies It - Blur Never Runs in A Fragment Stage
+struct PostProcessEffectInfo {
+    const char* name;
+    const char* fileName;
+    bool neighborhood;
+    const char* call;
+};
+static const PostProcessEffectInfo effectInfos[] {
+    {"Tonemap", "tonemap.glsl", false, "    color.rgb = applyTonemap(color.rgb);\n"},
+    {"Color Grade", "colorGrade.glsl", false, "    color.rgb = applyColorGrade(color.rgb);\n"},
+    {"Vignette", "vignette.glsl", false, "    color.rgb = applyVignette(color.rgb, texCords);\n"},
+    {"FXAA", "fxaa.glsl", true, "    vec4 color = applyFXAA(inputTexture, texCords);\n"},
+    {"Sharpen", "sharpen.glsl", true, "    vec4 color = applySharpen(inputTexture, texCords);\n"},
+    {"Blur", nullptr, false, nullptr},
+    {"Bloom", "bloom.glsl", false, "    color.rgb = applyBloom(color.rgb, texCords);\n"}
+};
+
+// Side Length of The Identity Color Grade LUT
+static const unsigned int identityLUTSize {16};
+
+// Blur Limits - Largest Radius The Shaders' Weight Arrays Hold and The Compute Blur's Pixels Per Workgroup Along The Blur Axis
+static const unsigned int maxBlurRadius {32};
+static const unsigned int blurTileSize {128};
+
+// Most Bloom Mip Levels
+static const unsigned int maxBloomLevels {8};
+
+// Image Formats Compute Passes Can Write The Chain's Output In
+static bool isStorageFormat(const GLenum &format) {
+    return format == GL_RGBA8 || format == GL_RGBA16F || format == GL_RGBA32F || format == GL_R11F_G11F_B10F || format == GL_RGB10_A2;
+}
+
+// Normalized Gaussian Weights of The Center and Each Distance Up to The Radius - The Radius Covers Two Standard Deviations
+static std::vector<float> gaussianWeights(const unsigned int &radius) {
+    std::vector<float> weights(radius + 1, 1.0f);
+    const float sigma {std::max(radius / 2.0f, 0.5f)};
+    float sum {0.0f};
+    for(unsigned int i {0}; i <= radius; i++) {
+        weights[i] = std::exp(-(float)(i * i) / (2.0f * sigma * sigma));
+        sum += i == 0 ? weights[i] : 2.0f * weights[i];
+    }
+    for(float &weight : weights) weight /= sum;
+    return weights;
+}
+
+// Pass Name Suffix of A Backend
+static const char* backendName(const sgl::PostProcessBackend &backend) {
+    return backend == sgl::PostProcessBackend::ComputeBackend ? " (Compute)" : " (Fragment)";
+}
+
+// Read A Shader Source File
+static std::string readShaderFile(const std::string &filePath) {
+    std::ifstream file(filePath, std::ifstream::in | std::ifstream::binary);
+    if(!file) {
+        std::cerr << "Failed to Read Shader File! " << filePath << std::endl;
+        return "";
+    }
+    std::stringstream buffer;
+    buffer << file.rdbuf();
+    return buffer.str();
+}
+
+// Constructor - Create The Empty Vertex Array and Identity LUT
+sgl::PostProcessChain::PostProcessChain(const std::string &shaderDirectory) {
+    this->shaderDirectory = shaderDirectory;
+    glGenVertexArrays(1, &this->vertexArray);
+
+    // Identity LUT - Every Color Maps to Itself
+    std::vector<std::uint8_t> lutData;
+    lutData.reserve(identityLUTSize * identityLUTSize * identityLUTSize * 3);
+    for(unsigned int b {0}; b < identityLUTSize; b++) {
+        for(unsigned int g {0}; g < identityLUTSize; g++) {
+            for(unsigned int r {0}; r < identityLUTSize; r++) {
+                lutData.push_back(r * 255 / (identityLUTSize - 1));
+                lutData.push_back(g * 255 / (identityLUTSize - 1));
+                lutData.push_back(b * 255 / (identityLUTSize - 1));
+            }
+        }
+    }
+    glGenTextures(1, &this->identityLUT);
+    glBindTexture(GL_TEXTURE_3D, this->identityLUT);
+    glTexStorage3D(GL_TEXTURE_3D, 1, GL_RGB8, identityLUTSize, identityLUTSize, identityLUTSize);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    glTexSubImage3D(GL_TEXTURE_3D, 0, 0, 0, 0, identityLUTSize, identityLUTSize, identityLUTSize, GL_RGB, GL_UNSIGNED_BYTE, lutData.data());
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+    glTexParameteri(GL_TEXTURE_3D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_3D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_3D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_3D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_3D, GL_TEXTURE_WRAP_R, GL_CLAMP_TO_EDGE);
+    glBindTexture(GL_TEXTURE_3D, 0);
+    this->colorGradeLUT = this->identityLUT;
+}
+
+// Setters
+void sgl::PostProcessChain::setEffects(const std::vector<sgl::PostProcessEffect> &effects) {
+    this->effects = effects;
+    this->stagesBuilt = false;
+}
+void sgl::PostProcessChain::setEffectBackend(const sgl::PostProcessEffect &effect, const sgl::PostProcessBackend &backend) {
+    this->effectBackends[effect] = backend;
+    this->stagesBuilt = false;
+}
+void sgl::PostProcessChain::setSettings(const sgl::PostProcessSettings &settings) {this->settings = settings;}
+void sgl::PostProcessChain::setColorGradeLUT(const GLuint &lut) {this->colorGradeLUT = lut != 0 ? lut : this->identityLUT;}
+
+// Add The Chain's Passes - Every Stage But The Last Writes A Transient Target, The Render Graph Aliases Every Other One So They Ping-Pong
+void sgl::PostProcessChain::addPasses(sgl::RenderGraph &renderGraph, const sgl::RenderGraphResource &input, const glm::uvec2 &inputSize, const sgl::RenderGraphResource &output, const glm::uvec2 &outputSize) {
+    // The Default Framebuffer is Imported With A Format That Can't Be Written as An Image
+    const bool upscale {inputSize != outputSize};
+    const bool storageOutput {isStorageFormat(renderGraph.getDesc(output).colorFormat)};
+    if(!this->stagesBuilt || this->stagesUpscale != upscale || this->stagesStorageOutput != storageOutput) this->buildStages(upscale, storageOutput);
+
+    sgl::RenderGraphResource image {input}, bloom {0};
+    for(std::size_t i {0}; i < this->stages.size(); i++) {
+        const sgl::PostProcessStage &stage {this->stages[i]};
+        const bool lastStage {i + 1 == this->stages.size()};
+        switch(stage.type) {
+            case sgl::PostProcessStageType::FragmentStage: {
+                // Bloom Composited Here Reads The Bloom Built by The Stage Before
+                const bool compositesBloom {std::find(stage.effects.begin(), stage.effects.end(), sgl::PostProcessEffect::BloomEffect) != stage.effects.end()};
+                std::vector<sgl::RenderGraphAccess> reads {{image, sgl::RenderGraphUsage::SampledTexture}};
+                if(compositesBloom) reads.push_back({bloom, sgl::RenderGraphUsage::SampledTexture});
+                const sgl::RenderGraphResource stageInput {image};
+                const sgl::RenderGraphResource stageOutput {lastStage ? output : renderGraph.createResource(stage.name, {outputSize.x, outputSize.y, GL_RGBA8, 0, 0})};
+                renderGraph.addPass(stage.name, reads, {{stageOutput, sgl::RenderGraphUsage::ColorAttachment}}, [this, i, stageInput, stageOutput, bloom, compositesBloom, outputSize](sgl::RenderGraph &graph) {
+                    graph.getTarget(stageOutput)->bind(GL_FRAMEBUFFER);
+                    glViewport(0, 0, outputSize.x, outputSize.y);
+                    this->drawStage(this->stages[i], *graph.getTarget(stageInput), compositesBloom ? graph.getTarget(bloom) : nullptr);
+                });
+                image = stageOutput;
+                break;
+            }
+            case sgl::PostProcessStageType::BlurStage: {
+                const sgl::RenderGraphResource stageOutput {lastStage ? output : renderGraph.createResource(stage.name, {outputSize.x, outputSize.y, GL_RGBA8, 0, 0})};
+                const GLenum format {lastStage ? renderGraph.getDesc(output).colorFormat : (GLenum)GL_RGBA8};
+                this->addBlurPasses(renderGraph, "Blur", image, stageOutput, outputSize, format, this->settings.blurRadius, stage.backend);
+                image = stageOutput;
+                break;
+            }
+            case sgl::PostProcessStageType::BloomStage:
+                bloom = this->addBloomPasses(renderGraph, image, outputSize, stage.backend);
+                break;
+        }
+    }
+}
+
+// Split The Effects Into Stages - A Neighborhood Effect Needs Its Input Finished, So It Starts A Stage Unless Nothing Ran Before It
+// Blur and Bloom Close The Stage Before Them, Dropping It if It Would Only Copy
+void sgl::PostProcessChain::buildStages(const bool &upscale, const bool &storageOutput) {
+    this->stages.clear();
+    this->stages.push_back(sgl::PostProcessStage());
+    this->stages.back().upscale = upscale;
+    for(const sgl::PostProcessEffect &effect : this->effects) {
+        if(effect == sgl::PostProcessEffect::BlurEffect || effect == sgl::PostProcessEffect::BloomEffect) {
+            if(!this->stages.back().upscale && this->stages.back().effects.empty()) this->stages.pop_back();
+            sgl::PostProcessStage passStage;
+            passStage.type = effect == sgl::PostProcessEffect::BlurEffect ? sgl::PostProcessStageType::BlurStage : sgl::PostProcessStageType::BloomStage;
+            passStage.backend = this->effectBackends[effect];
+            this->stages.push_back(passStage);
+            this->stages.push_back(sgl::PostProcessStage());
+            if(effect == sgl::PostProcessEffect::BloomEffect) this->stages.back().effects.push_back(effect);
+            continue;
+        }
+        if(effectInfos[effect].neighborhood && (this->stages.back().upscale || !this->stages.back().effects.empty())) {
+            this->stages.push_back(sgl::PostProcessStage());
+        }
+        this->stages.back().effects.push_back(effect);
+    }
+
+    // A Trailing Blur Writes The Output Itself Unless It's A Compute Blur and The Output Can't Be Written as An Image
+    if(this->stages.size() > 1 && this->stages.back().effects.empty() && this->stages[this->stages.size() - 2].type == sgl::PostProcessStageType::BlurStage) {
+        if(this->stages[this->stages.size() - 2].backend == sgl::PostProcessBackend::FragmentBackend || storageOutput) this->stages.pop_back();
+    }
+
+    // Name Stages After Their Effects - Names Double as Pass and Shader Names
+    for(sgl::PostProcessStage &stage : this->stages) {
+        if(stage.type != sgl::PostProcessStageType::FragmentStage) {
+            stage.name = std::string(stage.type == sgl::PostProcessStageType::BlurStage ? "Blur" : "Bloom") + backendName(stage.backend);
+            continue;
+        }
+        stage.name = "Post Processing (";
+        if(stage.upscale) stage.name += "Upscale";
+        for(const sgl::PostProcessEffect &effect : stage.effects) {
+            if(stage.name.back() != '(') stage.name += '+';
+            stage.name += effectInfos[effect].name;
+        }
+        if(stage.name.back() == '(') stage.name += "Copy";
+        stage.name += ')';
+        stage.program = this->getProgram(stage);
+    }
+    this->stagesUpscale = upscale;
+    this->stagesStorageOutput = storageOutput;
+    this->stagesBuilt = true;
+}
+
+// Get A Stage's Shader - Generated on First Use
+unsigned int sgl::PostProcessChain::getProgram(const sgl::PostProcessStage &stage) {
+    for(unsigned int i {0}; i < this->programs.size(); i++) {
+        if(this->programs[i].first == stage.name) return i;
+    }
+
+    // Header and Every Distinct Effect's Functions
+    std::string source {"#version 450 core\n\n// Input\nin vec2 texCords;\n\n// Uniform Variables\nuniform sampler2D inputTexture;\n\n// Output\nout vec4 fragColor;\n\n"};
+    if(stage.upscale) source += readShaderFile(this->shaderDirectory + "/upscale.glsl") + '\n';
+    std::vector<sgl::PostProcessEffect> included;
+    for(const sgl::PostProcessEffect &effect : stage.effects) {
+        if(std::find(included.begin(), included.end(), effect) != included.end()) continue;
+        source += readShaderFile(this->shaderDirectory + '/' + effectInfos[effect].fileName) + '\n';
+        included.push_back(effect);
+    }
+
+    // Main - Read The Input, Then Apply The Per Pixel Effects in Order
+    source += "// Main\nvoid main(void) {\n";
+    std::size_t firstPerPixel {0};
+    if(!stage.effects.empty() && effectInfos[stage.effects[0]].neighborhood) {
+        source += effectInfos[stage.effects[0]].call;
+        firstPerPixel = 1;
+    } else {
+        source += stage.upscale ? "    vec4 color = sampleCatmullRom(inputTexture, texCords);\n" : "    vec4 color = texture(inputTexture, texCords);\n";
+    }
+    for(std::size_t i {firstPerPixel}; i < stage.effects.size(); i++) {
+        source += effectInfos[stage.effects[i]].call;
+    }
+    source += "    fragColor = vec4(color.rgb, 1.0f);\n}\n";
+
+    // Compile and Keep
+    sgl::Shader shader;
+    shader.attachShader(this->shaderDirectory + "/vertexShader.glsl", sgl::ShaderType::VertexShader);
+    shader.attachShaderSource(source, sgl::ShaderType::FragmentShader);
+    shader.link();
+    this->programs.push_back({stage.name, shader});
+    return this->programs.size() - 1;
+}
+
+// Load A Blur/Bloom Shader - Fragment Shaders Share The Full Screen Vertex Shader
+unsigned int sgl::PostProcessChain::loadProgram(const std::string &fileName, const bool &compute) {
+    for(unsigned int i {0}; i < this->programs.size(); i++) {
+        if(this->programs[i].first == fileName) return i;
+    }
+    sgl::Shader shader;
+    if(compute) {
+        shader.attachShader(this->shaderDirectory + '/' + fileName, sgl::ShaderType::ComputeShader);
+    } else {
+        shader.attachShader(this->shaderDirectory + "/vertexShader.glsl", sgl::ShaderType::VertexShader);
+        shader.attachShader(this->shaderDirectory + '/' + fileName, sgl::ShaderType::FragmentShader);
+    }
+    shader.link();
+    this->programs.push_back({fileName, shader});
+    return this->programs.size() - 1;
+}
+
+// Add A Separable Blur - Compute Passes Load Each Workgroup's Row or Column Once Into Shared Memory, So Texture Fetches Per Pixel Stay Near One Instead of Growing With The Radius
+void sgl::PostProcessChain::addBlurPasses(sgl::RenderGraph &renderGraph, const std::string &name, const sgl::RenderGraphResource &input, const sgl::RenderGraphResource &output, const glm::uvec2 &size, const GLenum &format, const unsigned int &radius, const sgl::PostProcessBackend &backend) {
+    const bool compute {backend == sgl::PostProcessBackend::ComputeBackend};
+    const sgl::RenderGraphUsage writeUsage {compute ? sgl::RenderGraphUsage::StorageImage : sgl::RenderGraphUsage::ColorAttachment};
+    const sgl::RenderGraphResource intermediate {renderGraph.createResource(name + " Horizontal", {size.x, size.y, format, 0, 0})};
+    const std::vector<float> weights {gaussianWeights(std::min(radius, maxBlurRadius))};
+
+    // Horizontal Then Vertical - Compute Workgroups Cover blurTileSize Pixels of One Row or Column
+    const glm::ivec2 directions[2] {{1, 0}, {0, 1}};
+    const sgl::RenderGraphResource passInputs[2] {input, intermediate}, passOutputs[2] {intermediate, output};
+    for(unsigned int pass {0}; pass < 2; pass++) {
+        const glm::ivec2 direction {directions[pass]};
+        const sgl::RenderGraphResource passInput {passInputs[pass]}, passOutput {passOutputs[pass]};
+        const unsigned int lineLength {pass == 0 ? size.x : size.y}, lineCount {pass == 0 ? size.y : size.x};
+        const glm::uvec3 groupCount {(lineLength + blurTileSize - 1) / blurTileSize, lineCount, 1};
+        renderGraph.addPass(name + (pass == 0 ? " Horizontal" : " Vertical") + backendName(backend), {{passInput, sgl::RenderGraphUsage::SampledTexture}}, {{passOutput, writeUsage}}, [this, compute, backend, direction, passInput, passOutput, weights, groupCount](sgl::RenderGraph &graph) {
+            sgl::Shader &shader {this->programs[this->loadProgram(compute ? "blurComputeShader.glsl" : "blurFragmentShader.glsl", compute)].second};
+            shader.use();
+            shader.setInt("inputTexture", 0);
+            shader.setIVec2("direction", direction);
+            shader.setInt("radius", weights.size() - 1);
+            shader.setFloatArray("weights", weights);
+            glActiveTexture(GL_TEXTURE0);
+            graph.getTarget(passInput)->bindColorTexture();
+            this->runPass(shader, *graph.getTarget(passOutput), backend, groupCount);
+        });
+    }
+}
+
+// Add The Bloom Chain - Bright Parts Are Downsampled Into Half Sized Levels, Each Level Blurred, Then Upsampled Back Up Adding Every Level
+sgl::RenderGraphResource sgl::PostProcessChain::addBloomPasses(sgl::RenderGraph &renderGraph, const sgl::RenderGraphResource &input, const glm::uvec2 &size, const sgl::PostProcessBackend &backend) {
+    const bool compute {backend == sgl::PostProcessBackend::ComputeBackend};
+    const sgl::RenderGraphUsage writeUsage {compute ? sgl::RenderGraphUsage::StorageImage : sgl::RenderGraphUsage::ColorAttachment};
+    const std::string suffix {backendName(backend)};
+
+    // Downsample and Blur Each Level - Levels Stop Halving at One Pixel
+    std::vector<sgl::RenderGraphResource> levels;
+    std::vector<glm::uvec2> levelSizes;
+    glm::uvec2 levelSize {size};
+    sgl::RenderGraphResource source {input};
+    const unsigned int levelCount {std::clamp(this->settings.bloomLevels, 1u, maxBloomLevels)};
+    for(unsigned int level {0}; level < levelCount && (level == 0 || levelSize != glm::uvec2(1)); level++) {
+        levelSize = glm::max(levelSize / 2u, glm::uvec2(1));
+        const std::string levelName {"Bloom Level " + std::to_string(level)};
+        const sgl::RenderGraphResource levelResource {renderGraph.createResource(levelName, {levelSize.x, levelSize.y, GL_RGBA16F, 0, 0})};
+        const glm::uvec3 groupCount {(levelSize.x + 7) / 8, (levelSize.y + 7) / 8, 1};
+        renderGraph.addPass("Bloom Downsample " + std::to_string(level) + suffix, {{source, sgl::RenderGraphUsage::SampledTexture}}, {{levelResource, writeUsage}}, [this, compute, backend, level, source, levelResource, groupCount](sgl::RenderGraph &graph) {
+            sgl::Shader &shader {this->programs[this->loadProgram(compute ? "bloomDownsampleComputeShader.glsl" : "bloomDownsampleFragmentShader.glsl", compute)].second};
+            shader.use();
+            shader.setInt("inputTexture", 0);
+            shader.setBool("prefilter", level == 0);
+            shader.setFloat("threshold", this->settings.bloomThreshold);
+            shader.setFloat("knee", this->settings.bloomKnee);
+            glActiveTexture(GL_TEXTURE0);
+            graph.getTarget(source)->bindColorTexture();
+            this->runPass(shader, *graph.getTarget(levelResource), backend, groupCount);
+        });
+        this->addBlurPasses(renderGraph, "Bloom Blur " + std::to_string(level), levelResource, levelResource, levelSize, GL_RGBA16F, this->settings.bloomBlurRadius, backend);
+        levels.push_back(levelResource);
+        levelSizes.push_back(levelSize);
+        source = levelResource;
+    }
+
+    // Upsample - Each Level Plus The Tent Filtered Sum of The Levels Below It
+    sgl::RenderGraphResource accumulated {levels.back()};
+    for(std::size_t level {levels.size() - 1}; level-- > 0;) {
+        const sgl::RenderGraphResource lower {accumulated}, current {levels[level]};
+        const sgl::RenderGraphResource upsampled {renderGraph.createResource("Bloom Upsample " + std::to_string(level), {levelSizes[level].x, levelSizes[level].y, GL_RGBA16F, 0, 0})};
+        const glm::uvec3 groupCount {(levelSizes[level].x + 7) / 8, (levelSizes[level].y + 7) / 8, 1};
+        renderGraph.addPass("Bloom Upsample " + std::to_string(level) + suffix, {{current, sgl::RenderGraphUsage::SampledTexture}, {lower, sgl::RenderGraphUsage::SampledTexture}}, {{upsampled, writeUsage}}, [this, compute, backend, current, lower, upsampled, groupCount](sgl::RenderGraph &graph) {
+            sgl::Shader &shader {this->programs[this->loadProgram(compute ? "bloomUpsampleComputeShader.glsl" : "bloomUpsampleFragmentShader.glsl", compute)].second};
+            shader.use();
+            shader.setInt("inputTexture", 0);
+            shader.setInt("lowerTexture", 1);
+            glActiveTexture(GL_TEXTURE0);
+            graph.getTarget(current)->bindColorTexture();
+            glActiveTexture(GL_TEXTURE1);
+            graph.getTarget(lower)->bindColorTexture();
+            glActiveTexture(GL_TEXTURE0);
+            this->runPass(shader, *graph.getTarget(upsampled), backend, groupCount);
+        });
+        accumulated = upsampled;
+    }
+    return accumulated;
+}
+
+// Run A Blur/Bloom Shader Into A Target
+void sgl::PostProcessChain::runPass(sgl::Shader &shader, sgl::RenderTarget &output, const sgl::PostProcessBackend &backend, const glm::uvec3 &groupCount) {
+    if(backend == sgl::PostProcessBackend::ComputeBackend) {
+        shader.setInt("outputImage", 0);
+        glBindImageTexture(0, output.colorTexture, 0, GL_FALSE, 0, GL_WRITE_ONLY, output.desc.colorFormat);
+        glDispatchCompute(groupCount.x, groupCount.y, groupCount.z);
+    } else {
+        output.bind(GL_FRAMEBUFFER);
+        glViewport(0, 0, output.desc.width, output.desc.height);
+        glDisable(GL_DEPTH_TEST);
+        this->drawFullScreenTriangle();
+    }
+}
+
+// Draw A Stage - Only The Uniforms of Its Effects Are Set
+void sgl::PostProcessChain::drawStage(const sgl::PostProcessStage &stage, sgl::RenderTarget &input, sgl::RenderTarget* bloom) {
+    sgl::Shader &shader {this->programs[stage.program].second};
+    glDisable(GL_DEPTH_TEST);
+    shader.use();
+
+    // Input Texture
+    shader.setInt("inputTexture", 0);
+    glActiveTexture(GL_TEXTURE0);
+    input.bindColorTexture();
+
+    // Effect Parameters
+    for(const sgl::PostProcessEffect &effect : stage.effects) {
+        switch(effect) {
+            case sgl::PostProcessEffect::TonemapEffect:
+                shader.setFloat("exposure", this->settings.exposure);
+                break;
+            case sgl::PostProcessEffect::ColorGradeEffect:
+                shader.setInt("colorGradeLUT", 1);
+                shader.setFloat("colorGradeStrength", this->settings.colorGradeStrength);
+                glActiveTexture(GL_TEXTURE1);
+                glBindTexture(GL_TEXTURE_3D, this->colorGradeLUT);
+                glActiveTexture(GL_TEXTURE0);
+                SGL_STAT_ADD(sgl::StatCounter::TextureBindCount, 1);
+                break;
+            case sgl::PostProcessEffect::VignetteEffect:
+                shader.setFloat("vignetteIntensity", this->settings.vignetteIntensity);
+                shader.setFloat("vignetteRadius", this->settings.vignetteRadius);
+                shader.setFloat("vignetteSoftness", this->settings.vignetteSoftness);
+                break;
+            case sgl::PostProcessEffect::FXAAEffect:
+                shader.setFloat("fxaaSpanMax", this->settings.fxaaSpanMax);
+                shader.setFloat("fxaaEdgeThreshold", this->settings.fxaaEdgeThreshold);
+                shader.setFloat("fxaaEdgeThresholdMin", this->settings.fxaaEdgeThresholdMin);
+                break;
+            case sgl::PostProcessEffect::SharpenEffect:
+                shader.setFloat("sharpenStrength", this->settings.sharpenStrength);
+                break;
+            case sgl::PostProcessEffect::BloomEffect:
+                shader.setInt("bloomTexture", 2);
+                shader.setFloat("bloomIntensity", this->settings.bloomIntensity);
+                glActiveTexture(GL_TEXTURE2);
+                bloom->bindColorTexture();
+                glActiveTexture(GL_TEXTURE0);
+                break;
+            case sgl::PostProcessEffect::BlurEffect:
+            case sgl::PostProcessEffect::PostProcessEffectCount:
+                break;
+        }
+    }
+    this->drawFullScreenTriangle();
+}
+
+// Draw A Full Screen Triangle
+void sgl::PostProcessChain::drawFullScreenTriangle(void) {
+    glBindVertexArray(this->vertexArray);
+    glDrawArrays(GL_TRIANGLES, 0, 3);
+    SGL_STAT_ADD(sgl::StatCounter::DrawCallCount, 1);
+    SGL_STAT_ADD(sgl::StatCounter::TriangleCount, 1);
+    glBindVertexArray(0);
+}
+
+// Getters
+const std::vector<sgl::PostProcessEffect>& sgl::PostProcessChain::getEffects(void) {return this->effects;}
+sgl::PostProcessBackend sgl::PostProcessChain::getEffectBackend(const sgl::PostProcessEffect &effect) {return this->effectBackends[effect];}
+const sgl::PostProcessSettings& sgl::PostProcessChain::getSettings(void) {return this->settings;}
+std::size_t sgl::PostProcessChain::getStageCount(void) {return this->stages.size();}
+
+// Destroy Post Processing Chain
+void sgl::PostProcessChain::destroy(void) {
+    for(std::pair<std::string, sgl::Shader> &program : this->programs) {
+        program.second.destroy();
+    }
+    this->programs.clear();
+    glDeleteVertexArrays(1, &this->vertexArray);
+    glDeleteTextures(1, &this->identityLUT);
+}
@@ -0,0 +1,229 @@
+#include"../Engine.hpp"
+
+// Memory Barrier Making Shader Image Stores Visible to A Later Access
+static GLbitfield barrierBitsFor(const sgl::RenderGraphUsage &usage) {
+    switch(usage) {
+        case sgl::RenderGraphUsage::SampledTexture:
+            return GL_TEXTURE_FETCH_BARRIER_BIT;
+        case sgl::RenderGraphUsage::StorageImage:
+            return GL_SHADER_IMAGE_ACCESS_BARRIER_BIT;
+        case sgl::RenderGraphUsage::ColorAttachment:
+        case sgl::RenderGraphUsage::DepthAttachment:
+        case sgl::RenderGraphUsage::BlitSource:
+        case sgl::RenderGraphUsage::BlitDestination:
+            return GL_FRAMEBUFFER_BARRIER_BIT;
+    }
+    return 0;
+}
+
+// Constructor
+sgl::RenderGraph::RenderGraph(sgl::RenderTargetPool &renderTargetPool) {
+    this->renderTargetPool = &renderTargetPool;
+}
+
+// Declare A Transient Resource
+sgl::RenderGraphResource sgl::RenderGraph::createResource(const std::string &name, const sgl::RenderTargetDesc &desc) {
+    sgl::RenderGraphResourceNode resource;
+    resource.name = name;
+    resource.desc = desc;
+    this->resources.push_back(resource);
+    this->compiled = false;
+    return this->resources.size() - 1;
+}
+
+// Import A Target Owned Elsewhere
+sgl::RenderGraphResource sgl::RenderGraph::importResource(const std::string &name, sgl::RenderTarget &target) {
+    sgl::RenderGraphResourceNode resource;
+    resource.name = name;
+    resource.desc = target.desc;
+    resource.target = &target;
+    resource.imported = true;
+    this->resources.push_back(resource);
+    this->compiled = false;
+    return this->resources.size() - 1;
+}
+
+// Add A Pass
+unsigned int sgl::RenderGraph::addPass(const std::string &name, const std::vector<sgl::RenderGraphAccess> &reads, const std::vector<sgl::RenderGraphAccess> &writes, const std::function<void(sgl::RenderGraph&)> &execute) {
+    sgl::RenderGraphPass pass;
+    pass.name = name;
+    pass.reads = reads;
+    pass.writes = writes;
+    pass.execute = execute;
+    this->passes.push_back(std::move(pass));
+    this->compiled = false;
+    return this->passes.size() - 1;
+}
+void sgl::RenderGraph::setSideEffects(const unsigned int &pass) {
+    this->passes[pass].sideEffects = true;
+    this->compiled = false;
+}
+
+// Compile - Sort The Passes by Their Dependencies, Cull, Then Compute Lifetimes Over The Live Passes
+void sgl::RenderGraph::compile(void) {
+    this->stats = sgl::RenderGraphStats();
+    this->stats.passes = this->passes.size();
+    this->order.clear();
+    this->valid = false;
+    this->compiled = true;
+
+    // Dependencies - A Read Follows The Last Write Declared Before It, A Write Follows The Last Write and The Reads Since
+    // Transient Resources Hold Nothing Until Written, So A Read Declared Before Any Write Follows The First Write Declared After It
+    std::vector<std::vector<unsigned int>> dependents(this->passes.size());
+    std::vector<unsigned int> dependencyCounts(this->passes.size(), 0);
+    auto addDependency {[&dependents, &dependencyCounts](const int &pass, const unsigned int &dependent) {
+        if(pass < 0 || (unsigned int)pass == dependent) return;
+        dependents[pass].push_back(dependent);
+        dependencyCounts[dependent]++;
+    }};
+    std::vector<int> lastWriters(this->resources.size(), -1);
+    std::vector<std::vector<unsigned int>> readersSinceWrite(this->resources.size()), earlyReaders(this->resources.size());
+    for(unsigned int i {0}; i < this->passes.size(); i++) {
+        const sgl::RenderGraphPass &pass {this->passes[i]};
+        for(const sgl::RenderGraphAccess &read : pass.reads) {
+            if(lastWriters[read.resource] < 0 && !this->resources[read.resource].imported) {
+                earlyReaders[read.resource].push_back(i);
+                continue;
+            }
+            addDependency(lastWriters[read.resource], i);
+            readersSinceWrite[read.resource].push_back(i);
+        }
+        for(const sgl::RenderGraphAccess &write : pass.writes) {
+            addDependency(lastWriters[write.resource], i);
+            for(unsigned int reader : readersSinceWrite[write.resource]) addDependency(reader, i);
+            for(unsigned int reader : earlyReaders[write.resource]) addDependency(i, reader);
+            readersSinceWrite[write.resource] = earlyReaders[write.resource];
+            earlyReaders[write.resource].clear();
+            lastWriters[write.resource] = i;
+        }
+    }
+
+    // Transient Resources No Pass Writes Would Be Read Undefined - Nothing Executes Until The Graph is Fixed
+    bool unwrittenReads {false};
+    for(std::size_t i {0}; i < this->resources.size(); i++) {
+        for(unsigned int reader : earlyReaders[i]) {
+            std::cerr << "Render Graph Pass " << this->passes[reader].name << " Reads " << this->resources[i].name << " But No Pass Writes It!" << std::endl;
+            unwrittenReads = true;
+        }
+    }
+    if(unwrittenReads) return;
+
+    // Sort - The Earliest Declared Pass Whose Dependencies Have Run Goes Next, So Graphs Declared in Order Keep It
+    std::vector<bool> placed(this->passes.size(), false);
+    while(this->order.size() < this->passes.size()) {
+        unsigned int next {0};
+        while(next < this->passes.size() && (placed[next] || dependencyCounts[next] != 0)) next++;
+        if(next == this->passes.size()) {
+            std::cerr << "Render Graph Has A Dependency Cycle Between Its Passes!" << std::endl;
+            this->order.clear();
+            return;
+        }
+        placed[next] = true;
+        this->order.push_back(next);
+        for(unsigned int dependent : dependents[next]) dependencyCounts[dependent]--;
+    }
+
+    // Cull - Walking Backwards, A Pass is Needed if It Has Side Effects or Writes A Resource That's Imported or Read by A Needed Pass
+    std::vector<bool> needed(this->resources.size(), false);
+    for(std::size_t i {0}; i < this->resources.size(); i++) {
+        needed[i] = this->resources[i].imported;
+    }
+    for(std::size_t position {this->order.size()}; position-- > 0;) {
+        sgl::RenderGraphPass &pass {this->passes[this->order[position]]};
+        pass.culled = !pass.sideEffects && std::none_of(pass.writes.begin(), pass.writes.end(), [&needed](const sgl::RenderGraphAccess &write) {return needed[write.resource];});
+        if(pass.culled) {
+            this->stats.culledPasses++;
+            continue;
+        }
+        for(const sgl::RenderGraphAccess &read : pass.reads) {
+            needed[read.resource] = true;
+        }
+    }
+
+    // Lifetimes - Positions in The Sorted Order of The First and Last Live Pass Using Each Resource
+    for(sgl::RenderGraphResourceNode &resource : this->resources) {
+        resource.firstPass = resource.lastPass = -1;
+    }
+    for(std::size_t position {0}; position < this->order.size(); position++) {
+        const sgl::RenderGraphPass &pass {this->passes[this->order[position]]};
+        if(pass.culled) continue;
+        for(const std::vector<sgl::RenderGraphAccess>* accesses : {&pass.reads, &pass.writes}) {
+            for(const sgl::RenderGraphAccess &access : *accesses) {
+                sgl::RenderGraphResourceNode &resource {this->resources[access.resource]};
+                if(resource.firstPass < 0) resource.firstPass = position;
+                resource.lastPass = position;
+            }
+        }
+    }
+    for(const sgl::RenderGraphResourceNode &resource : this->resources) {
+        if(!resource.imported && resource.firstPass >= 0) this->stats.transientResources++;
+    }
+    this->valid = true;
+}
+
+// Execute The Live Passes in Sorted Order - Transient Targets Are Acquired Right Before Their First Use and Released Right After Their Last
+void sgl::RenderGraph::execute(sgl::GPUProfiler* profiler) {
+    if(!this->compiled) this->compile();
+    if(!this->valid) return;
+
+    // Barriers Are Tracked Per Physical Target - Image Stores Aren't Coherent, So Any Access After One Needs A Barrier Matching How It Accesses The Target,
+    // Even When The Store Was Through Another Resource Aliasing It
+    std::vector<sgl::RenderTarget*> physicalTargets, storeWrittenTargets;
+    for(std::size_t position {0}; position < this->order.size(); position++) {
+        sgl::RenderGraphPass &pass {this->passes[this->order[position]]};
+        if(pass.culled) continue;
+
+        // Acquire Targets of Resources First Used Here
+        for(sgl::RenderGraphResourceNode &resource : this->resources) {
+            if(resource.imported || resource.firstPass != (int)position) continue;
+            resource.target = this->renderTargetPool->acquire(resource.desc);
+            if(std::find(physicalTargets.begin(), physicalTargets.end(), resource.target) == physicalTargets.end()) {
+                physicalTargets.push_back(resource.target);
+            }
+        }
+
+        // Barriers For Targets With Pending Image Stores
+        pass.barrierBits = 0;
+        for(const std::vector<sgl::RenderGraphAccess>* accesses : {&pass.reads, &pass.writes}) {
+            for(const sgl::RenderGraphAccess &access : *accesses) {
+                sgl::RenderTarget* target {this->resources[access.resource].target};
+                if(std::find(storeWrittenTargets.begin(), storeWrittenTargets.end(), target) != storeWrittenTargets.end()) {
+                    pass.barrierBits |= barrierBitsFor(access.usage);
+                }
+            }
+        }
+        for(const sgl::RenderGraphAccess &write : pass.writes) {
+            sgl::RenderTarget* target {this->resources[write.resource].target};
+            std::erase(storeWrittenTargets, target);
+            if(write.usage == sgl::RenderGraphUsage::StorageImage) storeWrittenTargets.push_back(target);
+        }
+        if(pass.barrierBits != 0) this->stats.barriers++;
+
+        // Run The Pass
+        if(pass.barrierBits != 0) glMemoryBarrier(pass.barrierBits);
+        if(profiler != nullptr) profiler->beginPass(pass.name);
+        pass.execute(*this);
+        if(profiler != nullptr) profiler->endPass();
+
+        // Release Targets of Resources Last Used Here
+        for(sgl::RenderGraphResourceNode &resource : this->resources) {
+            if(resource.imported || resource.lastPass != (int)position) continue;
+            this->renderTargetPool->release(resource.target);
+            resource.target = nullptr;
+        }
+    }
+    this->stats.physicalTargets = physicalTargets.size();
+}
+
+// Drop All Passes and Resources
+void sgl::RenderGraph::reset(void) {
+    this->passes.clear();
+    this->resources.clear();
+    this->order.clear();
+    this->compiled = false;
+}
+
+// Getters
+sgl::RenderTarget* sgl::RenderGraph::getTarget(const sgl::RenderGraphResource &resource) {return this->resources[resource].target;}
+const sgl::RenderTargetDesc& sgl::RenderGraph::getDesc(const sgl::RenderGraphResource &resource) {return this->resources[resource].desc;}
+const sgl::RenderGraphStats& sgl::RenderGraph::getStats(void) {return this->stats;}
@@ -0,0 +1,135 @@
+#include"../Engine.hpp"
+
+// Sort Key Fields - Pass (2 Bits), Shader (10 Bits), Material (16 Bits), VAO (16 Bits) and Depth (20 Bits)
+// Fields Only Need to Group Equal States Together, Colliding IDs Just Cost An Extra State Change
+static const std::uint64_t shaderKeyMask {0x3FF}, materialKeyMask {0xFFFF}, vertexArrayKeyMask {0xFFFF}, depthKeyMask {0xFFFFF};
+
+// Depth Key - Bit Patterns of Non-Negative Floats Sort Like The Floats Themselves, So The Top 20 Bits Make A Monotonic Bucket
+static std::uint64_t depthKey(const float &depth) {
+    return (std::bit_cast<std::uint32_t>(glm::max(depth, 0.0f)) >> 11) & depthKeyMask;
+}
+
+// Submit A Prepared Mesh
+void sgl::RenderQueue::submit(const sgl::RenderPass &pass, sgl::Mesh &mesh, sgl::Shader &shader, const glm::mat4 &pvm, const float &depth) {
+    std::uint64_t shaderKey {shader.getProgram() & shaderKeyMask}, materialKey {mesh.getMaterialID() & materialKeyMask}, vertexArrayKey {mesh.getVertexArray() & vertexArrayKeyMask};
+
+    // Opaque - Group by State, Then Front to Back Within A State to Make The Most of Early Depth Testing
+    // Transparent - Back to Front Comes First For Correct Blending, State Only Breaks Ties
+    std::uint64_t key {(std::uint64_t)pass << 62};
+    if(pass == sgl::RenderPass::Opaque) {
+        key |= shaderKey << 52 | materialKey << 36 | vertexArrayKey << 20 | depthKey(depth);
+    } else {
+        key |= (~depthKey(depth) & depthKeyMask) << 42 | shaderKey << 32 | materialKey << 16 | vertexArrayKey;
+    }
+
+    this->keys.push_back(key);
+    this->items.push_back({&mesh, &shader, pvm, pass, (std::uint32_t)this->drawCounts.size(), (std::uint32_t)mesh.getDrawCounts().size()});
+    this->drawCounts.insert(this->drawCounts.end(), mesh.getDrawCounts().begin(), mesh.getDrawCounts().end());
+    this->drawOffsets.insert(this->drawOffsets.end(), mesh.getDrawOffsets().begin(), mesh.getDrawOffsets().end());
+}
+
+// Count State Changes of Executing The Items in The Given Order
+sgl::RenderStateChanges sgl::RenderQueue::countStateChanges(const std::vector<std::uint32_t> &itemOrder) {
+    sgl::RenderStateChanges stateChanges;
+    GLuint currentProgram {0}, currentMaterial {0}, currentVertexArray {0};
+    for(std::size_t i {0}; i < itemOrder.size(); i++) {
+        const sgl::RenderQueueItem &item {this->items[itemOrder[i]]};
+        GLuint program {item.shader->getProgram()}, material {item.mesh->getMaterialID()}, vertexArray {item.mesh->getVertexArray()};
+        bool shaderChanged {i == 0 || program != currentProgram};
+        if(shaderChanged) stateChanges.shaderChanges++;
+        if(shaderChanged || material != currentMaterial) stateChanges.materialChanges++;
+        if(shaderChanged || vertexArray != currentVertexArray) stateChanges.vertexArrayChanges++;
+        currentProgram = program;
+        currentMaterial = material;
+        currentVertexArray = vertexArray;
+    }
+    return stateChanges;
+}
+
+// Sort and Execute All Submissions, Then Clear The Queue
+void sgl::RenderQueue::execute(void) {
+    const std::size_t itemCount {this->items.size()};
+    this->stats = sgl::RenderQueueStats();
+    this->stats.drawCalls = itemCount;
+
+    // State Changes in Submission Order
+    this->order.resize(itemCount);
+    for(std::uint32_t i {0}; i < itemCount; i++) this->order[i] = i;
+    this->stats.unsorted = this->countStateChanges(this->order);
+
+    // LSD Radix Sort on 8-Bit Digits - All Histograms Are Built in One Pass and Digits Shared by Every Key Are Skipped
+    std::size_t histograms[8][256] {};
+    for(std::uint64_t key : this->keys) {
+        for(int digit {0}; digit < 8; digit++) histograms[digit][(key >> (digit * 8)) & 0xFF]++;
+    }
+    this->sortedKeys.resize(itemCount);
+    this->sortedOrder.resize(itemCount);
+    for(int digit {0}; digit < 8 && itemCount > 1; digit++) {
+        std::size_t* histogram {histograms[digit]};
+        if(histogram[(this->keys[0] >> (digit * 8)) & 0xFF] == itemCount) continue;
+
+        // Bucket Offsets
+        std::size_t offset {0};
+        for(int bucket {0}; bucket < 256; bucket++) {
+            std::size_t count {histogram[bucket]};
+            histogram[bucket] = offset;
+            offset += count;
+        }
+
+        // Stable Scatter
+        for(std::size_t i {0}; i < itemCount; i++) {
+            std::size_t destination {histogram[(this->keys[i] >> (digit * 8)) & 0xFF]++};
+            this->sortedKeys[destination] = this->keys[i];
+            this->sortedOrder[destination] = this->order[i];
+        }
+        this->keys.swap(this->sortedKeys);
+        this->order.swap(this->sortedOrder);
+    }
+
+    // State Changes After Sorting
+    this->stats.sorted = this->countStateChanges(this->order);
+
+    // Execute - Only Rebind What Changed, Switching Shaders Invalidates The Per-Program Material and Vertex Decoding Uniforms
+    GLuint currentProgram {0}, currentMaterial {0}, currentVertexArray {0};
+    bool blending {false};
+    for(std::size_t i {0}; i < itemCount; i++) {
+        sgl::RenderQueueItem &item {this->items[this->order[i]]};
+
+        // Transparent Pass - Blend Without Writing Depth
+        if(item.pass == sgl::RenderPass::Transparent && !blending) {
+            glEnable(GL_BLEND);
+            glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+            glDepthMask(GL_FALSE);
+            blending = true;
+        }
+
+        GLuint program {item.shader->getProgram()}, material {item.mesh->getMaterialID()}, vertexArray {item.mesh->getVertexArray()};
+        bool shaderChanged {i == 0 || program != currentProgram};
+        if(shaderChanged) item.shader->use();
+        if(shaderChanged || material != currentMaterial) item.mesh->bindTextures(*item.shader);
+        if(shaderChanged || vertexArray != currentVertexArray) item.mesh->bindVertexArray(*item.shader);
+        currentProgram = program;
+        currentMaterial = material;
+        currentVertexArray = vertexArray;
+
+        // Draw
+        item.shader->setMat4("pvm", item.pvm);
+        item.mesh->draw(&this->drawCounts[item.firstRange], &this->drawOffsets[item.firstRange], item.rangeCount);
+    }
+
+    // Restore Default State
+    glBindVertexArray(0);
+    if(blending) {
+        glDisable(GL_BLEND);
+        glDepthMask(GL_TRUE);
+    }
+
+    // Clear The Queue For The Next Frame
+    this->items.clear();
+    this->keys.clear();
+    this->drawCounts.clear();
+    this->drawOffsets.clear();
+}
+
+// Getters
+const sgl::RenderQueueStats& sgl::RenderQueue::getStats(void) {return this->stats;}
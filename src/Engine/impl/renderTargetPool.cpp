@@ -0,0 +1,160 @@
+#include"../Engine.hpp"
+
+// Bytes Per Pixel of A Sized Internal Format - Three Channel 8-Bit Formats Are Padded to Four Bytes by Drivers
+static std::size_t formatSize(const GLenum &format) {
+    switch(format) {
+        case 0:
+            return 0;
+        case GL_R8:
+            return 1;
+        case GL_RG8: case GL_R16F:
+            return 2;
+        case GL_RGB8: case GL_RGBA8: case GL_SRGB8: case GL_SRGB8_ALPHA8: case GL_RGB10_A2: case GL_R11F_G11F_B10F: case GL_RG16F: case GL_R32F:
+        case GL_DEPTH_COMPONENT24: case GL_DEPTH_COMPONENT32F: case GL_DEPTH24_STENCIL8:
+            return 4;
+        case GL_RGB16F: case GL_RGBA16F: case GL_RG32F: case GL_DEPTH32F_STENCIL8:
+            return 8;
+        case GL_RGB32F: case GL_RGBA32F:
+            return 16;
+        default:
+            return 4;
+    }
+}
+
+// Create A Texture With Immutable Storage For A Render Target Attachment
+static GLuint createAttachment(const sgl::RenderTargetDesc &desc, const GLenum &format, const bool &depth) {
+    GLuint texture;
+    glGenTextures(1, &texture);
+    if(desc.samples > 0) {
+        glBindTexture(GL_TEXTURE_2D_MULTISAMPLE, texture);
+        glTexStorage2DMultisample(GL_TEXTURE_2D_MULTISAMPLE, desc.samples, format, desc.width, desc.height, GL_TRUE);
+        glBindTexture(GL_TEXTURE_2D_MULTISAMPLE, 0);
+    } else {
+        // Texture Parameters - Color is Filtered, Depth is Read Texel by Texel
+        glBindTexture(GL_TEXTURE_2D, texture);
+        glTexStorage2D(GL_TEXTURE_2D, 1, format, desc.width, desc.height);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, depth ? GL_NEAREST : GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, depth ? GL_NEAREST : GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+        glBindTexture(GL_TEXTURE_2D, 0);
+    }
+    return texture;
+}
+
+// Render Target Binders
+void sgl::RenderTarget::bind(const GLenum &bindTarget) {
+    glBindFramebuffer(bindTarget, this->framebuffer);
+    SGL_STAT_ADD(sgl::StatCounter::StateChangeCount, 1);
+}
+void sgl::RenderTarget::bindColorTexture(void) {
+    glBindTexture(this->desc.samples > 0 ? GL_TEXTURE_2D_MULTISAMPLE : GL_TEXTURE_2D, this->colorTexture);
+    SGL_STAT_ADD(sgl::StatCounter::TextureBindCount, 1);
+}
+void sgl::RenderTarget::bindDepthTexture(void) {
+    glBindTexture(this->desc.samples > 0 ? GL_TEXTURE_2D_MULTISAMPLE : GL_TEXTURE_2D, this->depthTexture);
+    SGL_STAT_ADD(sgl::StatCounter::TextureBindCount, 1);
+}
+
+// Constructor
+sgl::RenderTargetPool::RenderTargetPool(const unsigned int &maxIdleFrames) {
+    this->maxIdleFrames = maxIdleFrames;
+}
+
+// Start A Frame - Destroy Targets Idle For Too Long
+void sgl::RenderTargetPool::beginFrame(void) {
+    this->frameIndex++;
+    std::erase_if(this->targets, [this](const std::unique_ptr<sgl::RenderTarget> &target) {
+        if(target->inUse || this->frameIndex - target->lastUsedFrame <= this->maxIdleFrames) return false;
+        this->free(*target);
+        return true;
+    });
+}
+
+// Acquire A Free Target Matching The Descriptor
+sgl::RenderTarget* sgl::RenderTargetPool::acquire(const sgl::RenderTargetDesc &desc) {
+    sgl::RenderTarget* target {nullptr};
+    for(std::unique_ptr<sgl::RenderTarget> &candidate : this->targets) {
+        if(!candidate->inUse && candidate->desc == desc) {
+            target = candidate.get();
+            break;
+        }
+    }
+
+    // None Free - Create One
+    if(target == nullptr) {
+        this->targets.push_back(std::make_unique<sgl::RenderTarget>());
+        target = this->targets.back().get();
+        target->desc = desc;
+        this->create(*target);
+    }
+    target->inUse = true;
+    target->lastUsedFrame = this->frameIndex;
+    return target;
+}
+
+// Release A Target Back to The Pool
+void sgl::RenderTargetPool::release(sgl::RenderTarget* target) {
+    target->inUse = false;
+    target->lastUsedFrame = this->frameIndex;
+}
+
+// Create A Target's Framebuffer and Attachments
+void sgl::RenderTargetPool::create(sgl::RenderTarget &target) {
+    const sgl::RenderTargetDesc &desc {target.desc};
+    glGenFramebuffers(1, &target.framebuffer);
+    glBindFramebuffer(GL_FRAMEBUFFER, target.framebuffer);
+    const GLenum textureTarget {desc.samples > 0 ? (GLenum)GL_TEXTURE_2D_MULTISAMPLE : (GLenum)GL_TEXTURE_2D};
+
+    // Color Attachment - Depth Only Targets Draw and Read No Color
+    if(desc.colorFormat != 0) {
+        target.colorTexture = createAttachment(desc, desc.colorFormat, false);
+        glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, textureTarget, target.colorTexture, 0);
+    } else {
+        glDrawBuffer(GL_NONE);
+        glReadBuffer(GL_NONE);
+    }
+
+    // Depth Attachment - Stencil Too For Packed Depth/Stencil Formats
+    if(desc.depthFormat != 0) {
+        const bool hasStencil {desc.depthFormat == GL_DEPTH24_STENCIL8 || desc.depthFormat == GL_DEPTH32F_STENCIL8};
+        target.depthTexture = createAttachment(desc, desc.depthFormat, true);
+        glFramebufferTexture2D(GL_FRAMEBUFFER, hasStencil ? GL_DEPTH_STENCIL_ATTACHMENT : GL_DEPTH_ATTACHMENT, textureTarget, target.depthTexture, 0);
+    }
+
+    // Check if Framebuffer Object is Complete
+    if(glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE) {
+        std::cerr << "Failed to Create Render Target!" << std::endl;
+    }
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+
+    target.memorySize = (std::size_t)desc.width * desc.height * std::max(desc.samples, 1u) * (formatSize(desc.colorFormat) + formatSize(desc.depthFormat));
+    this->createdCount++;
+}
+
+// Destroy A Target's Framebuffer and Attachments
+void sgl::RenderTargetPool::free(sgl::RenderTarget &target) {
+    glDeleteFramebuffers(1, &target.framebuffer);
+    if(target.colorTexture != 0) glDeleteTextures(1, &target.colorTexture);
+    if(target.depthTexture != 0) glDeleteTextures(1, &target.depthTexture);
+    target = sgl::RenderTarget();
+}
+
+// Getters
+std::size_t sgl::RenderTargetPool::getMemoryUsage(void) {
+    std::size_t memoryUsage {0};
+    for(const std::unique_ptr<sgl::RenderTarget> &target : this->targets) {
+        memoryUsage += target->memorySize;
+    }
+    return memoryUsage;
+}
+std::size_t sgl::RenderTargetPool::getTargetCount(void) {return this->targets.size();}
+std::uint64_t sgl::RenderTargetPool::getCreatedCount(void) {return this->createdCount;}
+
+// Destroy Render Target Pool
+void sgl::RenderTargetPool::destroy(void) {
+    for(std::unique_ptr<sgl::RenderTarget> &target : this->targets) {
+        this->free(*target);
+    }
+    this->targets.clear();
+}
@@ -1,7 +1,12 @@
 #include"../Engine.hpp"
 
+// Programs That Failed to Link Since Startup
+static std::atomic<unsigned int> failedProgramCount {0};
+
 // Create A Shader From It's Source File
 void sgl::Shader::attachShader(const std::string &shaderFilePath, const sgl::ShaderType &shaderType) {
+    SGL_PROFILE_SCOPE("Shader::attachShader");
+
     // Shader File
     std::ifstream shaderFile;
     shaderFile.exceptions(std::ifstream::badbit | std::ifstream::failbit);
@@ -23,8 +28,14 @@ void sgl::Shader::attachShader(const std::string &shaderFilePath, const sgl::Sha
         std::cerr << "Failed to Read Shader File! " << shaderFilePath << std::endl;
     }
 
+    // Compile and Attach Shader Source
+    this->attachShaderSource(shaderCppSrc, shaderType);
+}
+
+// Create A Shader From Source in Memory
+void sgl::Shader::attachShaderSource(const std::string &shaderSource, const sgl::ShaderType &shaderType) {
     // Convert Shader Source in C++ String to C String
-    const char* shaderSrc {shaderCppSrc.c_str()};
+    const char* shaderSrc {shaderSource.c_str()};
 
     // Shader
     GLuint shader;
@@ -38,6 +49,9 @@ void sgl::Shader::attachShader(const std::string &shaderFilePath, const sgl::Sha
         case sgl::ShaderType::GeometryShader:
             shader = glCreateShader(GL_GEOMETRY_SHADER);
             break;
+        case sgl::ShaderType::ComputeShader:
+            shader = glCreateShader(GL_COMPUTE_SHADER);
+            break;
         default:
             // Display Error Message
             std::cerr << "Unknown Shader Type Specified!" << std::endl;
@@ -66,6 +80,8 @@ void sgl::Shader::attachShader(const std::string &shaderFilePath, const sgl::Sha
 
 // Link Shader Program and Check For Link Errors
 void sgl::Shader::link(void) {
+    SGL_PROFILE_SCOPE("Shader::link");
+
     // Link Shader Program
     glLinkProgram(this->shaderProgram);
 
@@ -83,48 +99,78 @@ void sgl::Shader::link(void) {
 
         // Delete Shader Program
         glDeleteProgram(this->shaderProgram);
+        failedProgramCount.fetch_add(1, std::memory_order_relaxed);
     }
 }
 
+// Failed Shader Programs - A Failed Compile Leaves The Program Without That Stage, So It Fails to Link Too
+unsigned int sgl::getFailedShaderProgramCount(void) {return failedProgramCount.load(std::memory_order_relaxed);}
+
 // Use/Destroy Shaders
-void sgl::Shader::use(void) {glUseProgram(this->shaderProgram);}
+void sgl::Shader::use(void) {
+    glUseProgram(this->shaderProgram);
+    SGL_STAT_ADD(sgl::StatCounter::StateChangeCount, 1);
+}
 void sgl::Shader::destroy(void) {glDeleteProgram(this->shaderProgram);}
 
 // Setters - Set Uniform Variables
 void sgl::Shader::setBool(const std::string &uniformVarName, const bool &value) {
     glUniform1i(glGetUniformLocation(this->shaderProgram, uniformVarName.c_str()), value);
+    SGL_STAT_ADD(sgl::StatCounter::UniformUploadCount, 1);
 }
 void sgl::Shader::setInt(const std::string &uniformVarName, const int &value) {
     glUniform1i(glGetUniformLocation(this->shaderProgram, uniformVarName.c_str()), value);
+    SGL_STAT_ADD(sgl::StatCounter::UniformUploadCount, 1);
 }
 void sgl::Shader::setFloat(const std::string &uniformVarName, const float &value) {
     glUniform1f(glGetUniformLocation(this->shaderProgram, uniformVarName.c_str()), value);
+    SGL_STAT_ADD(sgl::StatCounter::UniformUploadCount, 1);
 }
 void sgl::Shader::setDouble(const std::string &uniformVarName, const double &value) {
     glUniform1d(glGetUniformLocation(this->shaderProgram, uniformVarName.c_str()), value);
+    SGL_STAT_ADD(sgl::StatCounter::UniformUploadCount, 1);
 }
 
 void sgl::Shader::setVec2(const std::string &uniformVarName, const glm::vec2 &value) {
     glUniform2fv(glGetUniformLocation(this->shaderProgram, uniformVarName.c_str()), 1, &value[0]);
+    SGL_STAT_ADD(sgl::StatCounter::UniformUploadCount, 1);
 }
 void sgl::Shader::setVec2(const std::string &uniformVarName, const float &a, const float &b) {
     glUniform2f(glGetUniformLocation(this->shaderProgram, uniformVarName.c_str()), a, b);
+    SGL_STAT_ADD(sgl::StatCounter::UniformUploadCount, 1);
+}
+void sgl::Shader::setIVec2(const std::string &uniformVarName, const glm::ivec2 &value) {
+    glUniform2iv(glGetUniformLocation(this->shaderProgram, uniformVarName.c_str()), 1, &value[0]);
+    SGL_STAT_ADD(sgl::StatCounter::UniformUploadCount, 1);
 }
 
 void sgl::Shader::setVec3(const std::string &uniformVarName, const glm::vec3 &value) {
     glUniform3fv(glGetUniformLocation(this->shaderProgram, uniformVarName.c_str()), 1, &value[0]);
+    SGL_STAT_ADD(sgl::StatCounter::UniformUploadCount, 1);
 }
 void sgl::Shader::setVec3(const std::string &uniformVarName, const float &a, const float &b, const float &c) {
     glUniform3f(glGetUniformLocation(this->shaderProgram, uniformVarName.c_str()), a, b, c);
+    SGL_STAT_ADD(sgl::StatCounter::UniformUploadCount, 1);
 }
 
 void sgl::Shader::setVec4(const std::string &uniformVarName, const glm::vec4 &value) {
     glUniform4fv(glGetUniformLocation(this->shaderProgram, uniformVarName.c_str()), 1, &value[0]);
+    SGL_STAT_ADD(sgl::StatCounter::UniformUploadCount, 1);
 }
 void sgl::Shader::setVec4(const std::string &uniformVarName, const float &a, const float &b, const float &c, const float &d) {
     glUniform4f(glGetUniformLocation(this->shaderProgram, uniformVarName.c_str()), a, b, c, d);
+    SGL_STAT_ADD(sgl::StatCounter::UniformUploadCount, 1);
 }
 
 void sgl::Shader::setMat4(const std::string &uniformVarName, const glm::mat4 &value) {
     glUniformMatrix4fv(glGetUniformLocation(this->shaderProgram, uniformVarName.c_str()), 1, GL_FALSE, &value[0][0]);
+    SGL_STAT_ADD(sgl::StatCounter::UniformUploadCount, 1);
 }
+
+void sgl::Shader::setFloatArray(const std::string &uniformVarName, const std::vector<float> &values) {
+    glUniform1fv(glGetUniformLocation(this->shaderProgram, uniformVarName.c_str()), values.size(), values.data());
+    SGL_STAT_ADD(sgl::StatCounter::UniformUploadCount, 1);
+}
+
+// Getters
+GLuint sgl::Shader::getProgram(void) {return this->shaderProgram;}
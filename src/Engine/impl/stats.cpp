@@ -0,0 +1,51 @@
+#include"../Engine.hpp"
+
+// Whether Counters Are Updated
+static std::atomic<bool> statsEnabled {false};
+
+// Registered Thread Counters - Kept After Their Threads Exit So Nothing Counted is Lost
+static std::mutex statsMutex;
+static std::vector<std::unique_ptr<sgl::StatsThreadCounters>> threadCounters;
+static thread_local sgl::StatsThreadCounters* currentCounters {nullptr};
+
+// Stats
+void sgl::setStatsEnabled(const bool &enabled) {statsEnabled.store(enabled, std::memory_order_relaxed);}
+bool sgl::isStatsEnabled(void) {return statsEnabled.load(std::memory_order_relaxed);}
+
+// Add to A Counter - Only The Owning Thread Adds and Only collectStats Resets, So Neither Contends
+void sgl::addStat(const sgl::StatCounter &counter, const std::uint64_t &value) {
+    if(!statsEnabled.load(std::memory_order_relaxed)) return;
+    if(currentCounters == nullptr) {
+        std::lock_guard<std::mutex> lock(statsMutex);
+        threadCounters.push_back(std::make_unique<sgl::StatsThreadCounters>());
+        currentCounters = threadCounters.back().get();
+    }
+    currentCounters->values[counter].fetch_add(value, std::memory_order_relaxed);
+}
+
+// Merge and Reset Every Thread's Counters
+sgl::FrameStats sgl::collectStats(void) {
+    sgl::FrameStats stats;
+    std::lock_guard<std::mutex> lock(statsMutex);
+    for(const std::unique_ptr<sgl::StatsThreadCounters> &counters : threadCounters) {
+        for(unsigned int i {0}; i < sgl::StatCounterCount; i++) {
+            stats.counters[i] += counters->values[i].exchange(0, std::memory_order_relaxed);
+        }
+    }
+    return stats;
+}
+
+// Format Frame Stats as Lines of Text
+std::string sgl::formatStats(const sgl::FrameStats &stats) {
+    std::ostringstream text;
+    text.setf(std::ios::fixed);
+    text.precision(2);
+    text << "Render CPU: " << stats.renderCPUTime << " ms  GPU: " << stats.gpuFrameTime << " ms\n";
+    text << "Draw Calls: " << stats.counters[sgl::StatCounter::DrawCallCount] << "\n";
+    text << "Triangles: " << stats.counters[sgl::StatCounter::TriangleCount] << "\n";
+    text << "State Changes: " << stats.counters[sgl::StatCounter::StateChangeCount] << "\n";
+    text << "Uniform Uploads: " << stats.counters[sgl::StatCounter::UniformUploadCount] << "\n";
+    text << "Texture Binds: " << stats.counters[sgl::StatCounter::TextureBindCount] << "\n";
+    text << "Buffer Uploads: " << stats.counters[sgl::StatCounter::BufferUploadBytes] / 1024.0 << " KiB";
+    return text.str();
+}
@@ -0,0 +1,88 @@
+#include"../Engine.hpp"
+
+// STB Easy Font - Header Only With Static Helpers This File Doesn't Use
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-function"
+#include<stb_easy_font.h>
+#pragma GCC diagnostic pop
+
+// stb_easy_font Vertex - Position and RGBA8 Color, Four Per Quad
+struct OverlayVertex {
+    float x, y, z;
+    unsigned char color[4];
+};
+
+// Constructor - Load Overlay Shaders and Create Buffers
+sgl::StatsOverlay::StatsOverlay(const std::string &vertexShaderFilePath, const std::string &fragmentShaderFilePath) {
+    this->shader.attachShader(vertexShaderFilePath, sgl::ShaderType::VertexShader);
+    this->shader.attachShader(fragmentShaderFilePath, sgl::ShaderType::FragmentShader);
+    this->shader.link();
+
+    glGenVertexArrays(1, &this->VAO);
+    glGenBuffers(1, &this->VBO);
+    glGenBuffers(1, &this->IBO);
+    glBindVertexArray(this->VAO);
+    glBindBuffer(GL_ARRAY_BUFFER, this->VBO);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, this->IBO);
+    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, sizeof(OverlayVertex), (void*)offsetof(OverlayVertex, x));
+    glEnableVertexAttribArray(0);
+    glVertexAttribPointer(1, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(OverlayVertex), (void*)offsetof(OverlayVertex, color));
+    glEnableVertexAttribArray(1);
+    glBindVertexArray(0);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+}
+
+// Draw Text With A Drop Shadow - Shadow and Text Quads Share One Vertex Buffer and One Draw
+void sgl::StatsOverlay::draw(const std::string &text, const glm::vec2 &position, const float &scale, const glm::ivec2 &viewportSize) {
+    if(text.empty()) return;
+
+    // Generate Quads - stb_easy_font Needs A Mutable String and About 270 Bytes of Vertices Per Character
+    this->text.assign(text.begin(), text.end());
+    this->text.push_back('\0');
+    this->vertices.resize(text.size() * 270 * 2);
+    unsigned char shadowColor[4] {0, 0, 0, 255}, textColor[4] {255, 255, 255, 255};
+    int quadCount {stb_easy_font_print(1.0f, 1.0f, this->text.data(), shadowColor, this->vertices.data(), this->vertices.size())};
+    quadCount += stb_easy_font_print(0.0f, 0.0f, this->text.data(), textColor, this->vertices.data() + quadCount * 4 * sizeof(OverlayVertex), this->vertices.size() - quadCount * 4 * sizeof(OverlayVertex));
+    if(quadCount == 0) return;
+
+    // Grow The Quad Index Buffer - Two Triangles Per Quad
+    glBindVertexArray(this->VAO);
+    if((std::size_t)quadCount > this->quadCapacity) {
+        this->quadCapacity = std::bit_ceil((std::size_t)quadCount);
+        std::vector<GLuint> indices(this->quadCapacity * 6);
+        for(GLuint i {0}; i < this->quadCapacity; i++) {
+            const GLuint quadIndices[6] {i * 4, i * 4 + 1, i * 4 + 2, i * 4, i * 4 + 2, i * 4 + 3};
+            std::copy(quadIndices, quadIndices + 6, &indices[i * 6]);
+        }
+        glBufferData(GL_ELEMENT_ARRAY_BUFFER, indices.size() * sizeof(GLuint), indices.data(), GL_STATIC_DRAW);
+        SGL_STAT_ADD(sgl::StatCounter::BufferUploadBytes, indices.size() * sizeof(GLuint));
+    }
+
+    // Upload Quads - Orphaning The Buffer So The Driver Doesn't Wait on Last Frame's Draw
+    const std::size_t vertexBytes {quadCount * 4 * sizeof(OverlayVertex)};
+    glBindBuffer(GL_ARRAY_BUFFER, this->VBO);
+    glBufferData(GL_ARRAY_BUFFER, vertexBytes, this->vertices.data(), GL_STREAM_DRAW);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    SGL_STAT_ADD(sgl::StatCounter::BufferUploadBytes, vertexBytes);
+
+    // Draw Over Everything
+    GLboolean depthTestEnabled {glIsEnabled(GL_DEPTH_TEST)};
+    glDisable(GL_DEPTH_TEST);
+    this->shader.use();
+    this->shader.setVec2("origin", position);
+    this->shader.setFloat("scale", scale);
+    this->shader.setVec2("viewportSize", glm::vec2(viewportSize));
+    glDrawElements(GL_TRIANGLES, quadCount * 6, GL_UNSIGNED_INT, nullptr);
+    SGL_STAT_ADD(sgl::StatCounter::DrawCallCount, 1);
+    SGL_STAT_ADD(sgl::StatCounter::TriangleCount, quadCount * 2);
+    glBindVertexArray(0);
+    if(depthTestEnabled) glEnable(GL_DEPTH_TEST);
+}
+
+// Destroy Stats Overlay
+void sgl::StatsOverlay::destroy(void) {
+    glDeleteVertexArrays(1, &this->VAO);
+    glDeleteBuffers(1, &this->VBO);
+    glDeleteBuffers(1, &this->IBO);
+    this->shader.destroy();
+}
@@ -1,8 +1,12 @@
+// STB Image Implementation - Compiled Once Into The Engine Library
+#define STB_IMAGE_IMPLEMENTATION
 #include"../Engine.hpp"
 #include <GL/gl.h>
 
 // Create 2D Texture Image
 void sgl::Texture::create2DImg(const std::string &texImgFilePath) {
+    SGL_PROFILE_SCOPE("Texture::create2DImg");
+
     // Create A Texture Object
     glGenTextures(1, &this->texture);
     glBindTexture(GL_TEXTURE_2D, this->texture);
@@ -45,6 +49,8 @@ void sgl::Texture::create2DImg(const std::string &texImgFilePath) {
 
 // Create A Cubemap Texture Object
 void sgl::Texture::createCubemap(const std::vector<std::string> &texImgFilePaths) {
+    SGL_PROFILE_SCOPE("Texture::createCubemap");
+
     // Create A Texture Object
     glGenTextures(1, &this->texture);
     glBindTexture(GL_TEXTURE_CUBE_MAP, this->texture);
@@ -84,6 +90,9 @@ void sgl::Texture::setParameteri(const GLenum &parameter, const GLint &value) {g
 void sgl::Texture::setParameterf(const GLenum &parameter, const GLfloat &value) {glTexParameterf(this->bindTarget, parameter, value);}
 
 // Bind/Unbind/Destroy Texture Object
-void sgl::Texture::bind(void) {glBindTexture(this->bindTarget, this->texture);}
+void sgl::Texture::bind(void) {
+    glBindTexture(this->bindTarget, this->texture);
+    SGL_STAT_ADD(sgl::StatCounter::TextureBindCount, 1);
+}
 void sgl::Texture::unbind(void) {glBindTexture(this->bindTarget, 0);}
 void sgl::Texture::destroy(void) {glDeleteTextures(1, &this->texture);}
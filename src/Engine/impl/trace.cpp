@@ -0,0 +1,159 @@
+#include"../Engine.hpp"
+#include<unordered_set>
+#include<iomanip>
+
+// Whether Scopes Are Recorded
+static std::atomic<bool> tracingEnabled {false};
+
+// Registered Thread Buffers and The GPU Timeline Buffer - Buffers Outlive Their Threads So Their Events Can Still Be Exported
+static std::mutex traceMutex;
+static std::vector<std::unique_ptr<sgl::TraceBuffer>> threadBuffers;
+static std::unique_ptr<sgl::TraceBuffer> gpuBuffer;
+static std::unordered_set<std::string> internedNames;
+
+// Calling Thread's Buffer and The Name Given Before It Was Created
+static thread_local sgl::TraceBuffer* currentBuffer {nullptr};
+static thread_local std::string currentThreadName;
+
+// Trace Start - Set on First Use
+static std::chrono::steady_clock::time_point getTraceEpoch(void) {
+    static const std::chrono::steady_clock::time_point epoch {std::chrono::steady_clock::now()};
+    return epoch;
+}
+
+// Append An Event and Publish It
+static void writeEvent(sgl::TraceBuffer &buffer, const char* name, const std::uint64_t &start, const std::uint64_t &duration) {
+    const std::uint64_t head {buffer.head.load(std::memory_order_relaxed)};
+    buffer.events[head % sgl::TraceBuffer::capacity] = {name, start, duration};
+    buffer.head.store(head + 1, std::memory_order_release);
+}
+
+// Copy A Buffer's Retained Events - Events The Writer May Have Overwritten While Copying Are Discarded
+static std::vector<sgl::TraceEvent> copyEvents(const sgl::TraceBuffer &buffer) {
+    const std::uint64_t capacity {sgl::TraceBuffer::capacity};
+    const std::uint64_t head {buffer.head.load(std::memory_order_acquire)};
+    std::vector<sgl::TraceEvent> events;
+    events.reserve(std::min(head, capacity));
+    for(std::uint64_t i {head > capacity ? head - capacity : 0}; i < head; i++) {
+        events.push_back(buffer.events[i % capacity]);
+    }
+
+    // The Writer Can Be One Event Past The Head It Published, So The Oldest Slot of The New Head is Unsafe Too
+    const std::uint64_t newHead {buffer.head.load(std::memory_order_acquire)};
+    const std::uint64_t firstSafe {newHead >= capacity ? newHead - capacity + 1 : 0};
+    const std::uint64_t firstCopied {head > capacity ? head - capacity : 0};
+    if(firstSafe > firstCopied) {
+        events.erase(events.begin(), events.begin() + std::min<std::uint64_t>(firstSafe - firstCopied, events.size()));
+    }
+    return events;
+}
+
+// Escape A Name For A JSON String
+static std::string escapeJSON(const std::string &text) {
+    std::string escaped;
+    escaped.reserve(text.size());
+    for(char c : text) {
+        if(c == '"' || c == '\\') {
+            escaped += '\\';
+            escaped += c;
+        } else if((unsigned char)c < 0x20) {
+            escaped += ' ';
+        } else {
+            escaped += c;
+        }
+    }
+    return escaped;
+}
+
+// Tracing
+void sgl::setTracingEnabled(const bool &enabled) {
+    getTraceEpoch();
+    tracingEnabled.store(enabled, std::memory_order_relaxed);
+}
+bool sgl::isTracingEnabled(void) {return tracingEnabled.load(std::memory_order_relaxed);}
+
+// Nanoseconds Since The Trace Started
+std::uint64_t sgl::getTraceTime(void) {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - getTraceEpoch()).count();
+}
+
+// Record A Finished Scope - Lock-Free Once The Thread's Buffer Exists
+void sgl::recordTraceEvent(const char* name, const std::uint64_t &start, const std::uint64_t &duration) {
+    if(currentBuffer == nullptr) {
+        std::lock_guard<std::mutex> lock(traceMutex);
+        threadBuffers.push_back(std::make_unique<sgl::TraceBuffer>());
+        currentBuffer = threadBuffers.back().get();
+        currentBuffer->threadID = threadBuffers.size();
+        currentBuffer->threadName = currentThreadName.empty() ? "Thread " + std::to_string(currentBuffer->threadID) : currentThreadName;
+    }
+    writeEvent(*currentBuffer, name, start, duration);
+}
+
+// Record A Scope on The GPU Timeline
+void sgl::recordGPUTraceEvent(const char* name, const std::uint64_t &start, const std::uint64_t &duration) {
+    if(gpuBuffer == nullptr) {
+        std::lock_guard<std::mutex> lock(traceMutex);
+        gpuBuffer = std::make_unique<sgl::TraceBuffer>();
+        gpuBuffer->threadID = 1;
+        gpuBuffer->threadName = "GPU";
+    }
+    writeEvent(*gpuBuffer, name, start, duration);
+}
+
+// Name The Calling Thread - Applied Now or When Its Buffer is Created
+void sgl::setTraceThreadName(const std::string &name) {
+    currentThreadName = name;
+    if(currentBuffer != nullptr) {
+        std::lock_guard<std::mutex> lock(traceMutex);
+        currentBuffer->threadName = name;
+    }
+}
+
+// Intern A Name - Set Elements Don't Move When The Set Grows
+const char* sgl::internTraceName(const std::string &name) {
+    std::lock_guard<std::mutex> lock(traceMutex);
+    return internedNames.insert(name).first->c_str();
+}
+
+// Write Chrome Trace Event JSON - CPU Threads Are Process 1, The GPU Timeline is Process 2
+bool sgl::exportChromeTrace(const std::string &filePath) {
+    std::ofstream file(filePath);
+    if(!file) {
+        std::cerr << "Failed to Open Trace File!" << std::endl;
+        return false;
+    }
+    file << std::fixed << std::setprecision(3);
+    file << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n";
+    file << "{\"ph\":\"M\",\"pid\":1,\"tid\":0,\"name\":\"process_name\",\"args\":{\"name\":\"CPU\"}},\n";
+    file << "{\"ph\":\"M\",\"pid\":2,\"tid\":0,\"name\":\"process_name\",\"args\":{\"name\":\"GPU\"}}";
+
+    // Thread Name and Complete Events - Trace Times Are in Microseconds
+    auto writeBuffer {[&file](const sgl::TraceBuffer &buffer, const unsigned int &pid) {
+        file << ",\n{\"ph\":\"M\",\"pid\":" << pid << ",\"tid\":" << buffer.threadID << ",\"name\":\"thread_name\",\"args\":{\"name\":\"" << escapeJSON(buffer.threadName) << "\"}}";
+        for(const sgl::TraceEvent &event : copyEvents(buffer)) {
+            file << ",\n{\"ph\":\"X\",\"pid\":" << pid << ",\"tid\":" << buffer.threadID << ",\"name\":\"" << escapeJSON(event.name) << "\",\"ts\":" << event.start / 1000.0 << ",\"dur\":" << event.duration / 1000.0 << "}";
+        }
+    }};
+    {
+        std::lock_guard<std::mutex> lock(traceMutex);
+        for(const std::unique_ptr<sgl::TraceBuffer> &buffer : threadBuffers) {
+            writeBuffer(*buffer, 1);
+        }
+        if(gpuBuffer != nullptr) {
+            writeBuffer(*gpuBuffer, 2);
+        }
+    }
+    file << "\n]}\n";
+    return (bool)file;
+}
+
+// Trace Scope
+sgl::TraceScope::TraceScope(const char* name) {
+    if(!tracingEnabled.load(std::memory_order_relaxed)) return;
+    this->name = name;
+    this->start = sgl::getTraceTime();
+}
+sgl::TraceScope::~TraceScope(void) {
+    if(this->name == nullptr) return;
+    sgl::recordTraceEvent(this->name, this->start, sgl::getTraceTime() - this->start);
+}
@@ -0,0 +1,102 @@
+// Standard Headers
+#include<iostream>
+#include<iomanip>
+#include<random>
+#include<chrono>
+#include<cstdlib>
+
+// Custom Engine Headers
+#include"../Engine/Engine.hpp"
+
+// Benchmark Config
+const unsigned int instanceCounts[] {1000, 10000, 100000};
+const unsigned int queryCount {200};
+const float sceneSize {500.0f};
+
+// Time A Function in Microseconds Per Call
+template<typename Function>
+static double timeMicroseconds(const unsigned int &iterations, Function function) {
+    std::chrono::steady_clock::time_point start {std::chrono::steady_clock::now()};
+    for(unsigned int i {0}; i < iterations; i++) function(i);
+    std::chrono::duration<double, std::micro> elapsed {std::chrono::steady_clock::now() - start};
+    return elapsed.count() / iterations;
+}
+
+// Main
+int main(void) {
+    std::mt19937 rng(1234);
+    std::uniform_real_distribution<float> positionDist(-sceneSize, sceneSize), sizeDist(0.5f, 4.0f), angleDist(0.0f, 360.0f);
+
+    // Camera Projection and Views Looking Around The Scene Center
+    glm::mat4 projectionMatrix {glm::perspective(glm::radians(70.0f), 16.0f / 9.0f, 0.1f, 300.0f)};
+    std::vector<sgl::Frustum> frustums;
+    std::vector<glm::vec3> rayOrigins, rayDirections;
+    for(unsigned int i {0}; i < queryCount; i++) {
+        float yaw {glm::radians(angleDist(rng))};
+        glm::vec3 position {positionDist(rng) * 0.5f, 0.0f, positionDist(rng) * 0.5f};
+        glm::vec3 front {glm::cos(yaw), 0.0f, glm::sin(yaw)};
+        frustums.emplace_back(projectionMatrix * glm::lookAt(position, position + front, glm::vec3(0.0f, 1.0f, 0.0f)));
+        rayOrigins.push_back(position);
+        rayDirections.push_back(front);
+    }
+
+    std::cout << std::left << std::setw(12) << "Instances" << std::setw(14) << "Build (ms)" << std::setw(18) << "Brute Cull (us)" << std::setw(16) << "BVH Cull (us)" << std::setw(18) << "Brute Ray (us)" << std::setw(16) << "BVH Ray (us)" << "Visible" << std::endl;
+    for(unsigned int instanceCount : instanceCounts) {
+        // Random Instance Bounding Boxes
+        std::vector<sgl::BoundingBox> instanceBounds(instanceCount);
+        sgl::BoundingBoxList boxList;
+        for(sgl::BoundingBox &bounds : instanceBounds) {
+            glm::vec3 center {positionDist(rng), positionDist(rng) * 0.1f, positionDist(rng)}, extent {sizeDist(rng), sizeDist(rng), sizeDist(rng)};
+            bounds.min = center - extent;
+            bounds.max = center + extent;
+            boxList.add(bounds);
+        }
+
+        // Build BVH
+        sgl::SceneBVH bvh;
+        double buildTime {timeMicroseconds(1, [&](unsigned int) {bvh.build(instanceBounds);}) / 1000.0};
+
+        // Frustum Culling - Brute Force SIMD vs BVH
+        std::vector<unsigned int> visible;
+        std::size_t bruteVisible {0}, bvhVisible {0};
+        double bruteCullTime {timeMicroseconds(queryCount, [&](unsigned int i) {
+            visible.clear();
+            frustums[i].cullBoxes(boxList, visible);
+            bruteVisible += visible.size();
+        })};
+        double bvhCullTime {timeMicroseconds(queryCount, [&](unsigned int i) {
+            visible.clear();
+            bvh.cullFrustum(frustums[i], visible);
+            bvhVisible += visible.size();
+        })};
+
+        // Ray Queries - Brute Force vs BVH
+        sgl::RayHit hit;
+        std::vector<float> bruteDistances(queryCount), bvhDistances(queryCount);
+        double bruteRayTime {timeMicroseconds(queryCount, [&](unsigned int i) {
+            glm::vec3 inverseDirection {1.0f / rayDirections[i]};
+            float closest {std::numeric_limits<float>::infinity()};
+            for(const sgl::BoundingBox &bounds : instanceBounds) {
+                glm::vec3 t0 {(bounds.min - rayOrigins[i]) * inverseDirection}, t1 {(bounds.max - rayOrigins[i]) * inverseDirection};
+                glm::vec3 tNear {glm::min(t0, t1)}, tFar {glm::max(t0, t1)};
+                float entry {glm::max(glm::max(tNear.x, tNear.y), glm::max(tNear.z, 0.0f))}, exit {glm::min(glm::min(tFar.x, tFar.y), tFar.z)};
+                if(entry <= exit && entry < closest) closest = entry;
+            }
+            bruteDistances[i] = closest;
+        })};
+        double bvhRayTime {timeMicroseconds(queryCount, [&](unsigned int i) {
+            bvhDistances[i] = bvh.raycast(rayOrigins[i], rayDirections[i], hit) ? hit.distance : std::numeric_limits<float>::infinity();
+        })};
+
+        // Brute Force and BVH Must Agree
+        if(bruteVisible != bvhVisible || bruteDistances != bvhDistances) {
+            std::cerr << "BVH and Brute Force Queries Disagree!" << std::endl;
+            return EXIT_FAILURE;
+        }
+
+        std::cout << std::left << std::fixed << std::setprecision(2) << std::setw(12) << instanceCount << std::setw(14) << buildTime << std::setw(18) << bruteCullTime << std::setw(16) << bvhCullTime << std::setw(18) << bruteRayTime << std::setw(16) << bvhRayTime << bruteVisible / queryCount << std::endl;
+    }
+
+    // Return Successful Exit Code
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,102 @@
+// Standard Headers
+#include<iostream>
+#include<iomanip>
+#include<chrono>
+#include<cmath>
+#include<cstdlib>
+
+// Custom Engine Headers
+#include"../Engine/Engine.hpp"
+
+// Benchmark Config
+const unsigned int spawnJobCount {100000};
+const std::size_t workItemCount {1 << 20};
+const std::size_t grainSizes[] {256, 4096, 65536};
+const unsigned int repetitions {5};
+
+// Time A Function in Microseconds Per Call
+template<typename Function>
+static double timeMicroseconds(const unsigned int &iterations, Function function) {
+    std::chrono::steady_clock::time_point start {std::chrono::steady_clock::now()};
+    for(unsigned int i {0}; i < iterations; i++) function(i);
+    std::chrono::duration<double, std::micro> elapsed {std::chrono::steady_clock::now() - start};
+    return elapsed.count() / iterations;
+}
+
+// Work Item - Enough Arithmetic That Memory Bandwidth Doesn't Hide Scaling
+static float workItem(const std::size_t &i) {
+    float value {(float)i};
+    for(unsigned int j {0}; j < 64; j++) value = std::sqrt(value * 1.0001f + 1.0f);
+    return value;
+}
+
+// Main
+int main(void) {
+    const unsigned int hardwareThreads {std::max(std::thread::hardware_concurrency(), 1u)};
+
+    // Reference Result on One Thread
+    std::vector<float> expected(workItemCount), results(workItemCount);
+    double serialTime {timeMicroseconds(repetitions, [&](unsigned int) {
+        for(std::size_t i {0}; i < workItemCount; i++) expected[i] = workItem(i);
+    }) / 1000.0};
+    std::cout << "Serial Work: " << std::fixed << std::setprecision(2) << serialTime << " ms" << std::endl << std::endl;
+
+    std::cout << std::left << std::setw(10) << "Threads" << std::setw(16) << "Spawn (ns)" << std::setw(18) << "Spawn Chain (ns)";
+    for(std::size_t grainSize : grainSizes) std::cout << std::setw(22) << "For Grain " + std::to_string(grainSize) + " (ms)";
+    std::cout << "Speedup" << std::endl;
+
+    // Thread Counts Include The Main Thread - Doubling Worker Counts Up to All Hardware Threads
+    std::vector<unsigned int> workerCounts;
+    for(unsigned int workerCount {1}; workerCount < hardwareThreads; workerCount *= 2) workerCounts.push_back(workerCount);
+    if(workerCounts.empty() || workerCounts.back() != hardwareThreads - 1) workerCounts.push_back(std::max(hardwareThreads - 1, 1u));
+    for(unsigned int workerCount : workerCounts) {
+        const unsigned int threadCount {workerCount + 1};
+        sgl::JobSystem jobSystem(workerCount);
+
+        // Spawn Overhead - Empty Jobs Spawned From The Main Thread, Then One Wait
+        std::atomic<unsigned int> executed {0};
+        double spawnTime {timeMicroseconds(1, [&](unsigned int) {
+            sgl::JobCounter counter;
+            for(unsigned int i {0}; i < spawnJobCount; i++) {
+                jobSystem.run([&executed](void) {executed.fetch_add(1, std::memory_order_relaxed);}, &counter);
+            }
+            jobSystem.wait(counter);
+        }) * 1000.0 / spawnJobCount};
+
+        // Dependency Overhead - Jobs Waiting on The Previous Job's Counter
+        const unsigned int chainLength {1000};
+        double chainTime {timeMicroseconds(1, [&](unsigned int) {
+            std::vector<sgl::JobCounter> counters(chainLength);
+            for(unsigned int i {0}; i < chainLength; i++) {
+                jobSystem.run([&executed](void) {executed.fetch_add(1, std::memory_order_relaxed);}, &counters[i], i > 0 ? &counters[i - 1] : nullptr);
+            }
+            jobSystem.wait(counters.back());
+        }) * 1000.0 / chainLength};
+        if(executed != spawnJobCount + chainLength) {
+            std::cerr << "Jobs Were Lost or Run Twice!" << std::endl;
+            return EXIT_FAILURE;
+        }
+        std::cout << std::left << std::fixed << std::setprecision(2) << std::setw(10) << threadCount << std::setw(16) << spawnTime << std::setw(18) << chainTime;
+
+        // Parallel For Scaling
+        double bestTime {serialTime};
+        for(std::size_t grainSize : grainSizes) {
+            double forTime {timeMicroseconds(repetitions, [&](unsigned int) {
+                jobSystem.parallelFor(workItemCount, grainSize, [&](const std::size_t &begin, const std::size_t &end) {
+                    for(std::size_t i {begin}; i < end; i++) results[i] = workItem(i);
+                });
+            }) / 1000.0};
+            if(results != expected) {
+                std::cerr << "Parallel For Results Differ From Serial Results!" << std::endl;
+                return EXIT_FAILURE;
+            }
+            bestTime = std::min(bestTime, forTime);
+            std::cout << std::setw(22) << forTime;
+        }
+        std::cout << serialTime / bestTime << "x" << std::endl;
+        jobSystem.destroy();
+    }
+
+    // Return Successful Exit Code
+    return EXIT_SUCCESS;
+}
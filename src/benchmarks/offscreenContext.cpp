@@ -0,0 +1,100 @@
+#include"../Engine/Engine.hpp"
+#include"offscreenContext.hpp"
+
+// Context Versions Tried in Order
+static const int contextVersions[][2] {{4, 6}, {4, 5}};
+
+// Whether A Space Separated EGL Extension String Lists An Extension
+static bool hasExtension(const char* extensions, const std::string &extension) {
+    if(extensions == nullptr) return false;
+    std::istringstream stream(extensions);
+    std::string name;
+    while(stream >> name) {
+        if(name == extension) return true;
+    }
+    return false;
+}
+
+// OSMesa Through GLFW's Null Platform - Needs libOSMesa at Runtime
+static bool createOSMesaContext(OffscreenContext &context, const char* name) {
+    glfwInitHint(GLFW_PLATFORM, GLFW_PLATFORM_NULL);
+    if(!glfwInit()) return false;
+    for(const int* version : contextVersions) {
+        glfwDefaultWindowHints();
+        glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+        glfwWindowHint(GLFW_CONTEXT_CREATION_API, GLFW_OSMESA_CONTEXT_API);
+        glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+        glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, version[0]);
+        glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, version[1]);
+        context.window = glfwCreateWindow(64, 64, name, nullptr, nullptr);
+        if(context.window != nullptr) break;
+    }
+    if(context.window == nullptr) {
+        glfwTerminate();
+        return false;
+    }
+    glfwMakeContextCurrent(context.window);
+    glfwSwapInterval(0);
+    return gladLoadGL(glfwGetProcAddress) != 0;
+}
+
+// EGL on Mesa's Surfaceless Platform - GLFW Only Picks Configs With A Window Surface, So The Context is Created Here Directly
+static bool createSurfacelessEGLContext(OffscreenContext &context) {
+    // Surfaceless Display - Needs No Window System or GPU Device Node
+    const char* clientExtensions {eglQueryString(EGL_NO_DISPLAY, EGL_EXTENSIONS)};
+    if(!hasExtension(clientExtensions, "EGL_MESA_platform_surfaceless")) {
+        std::cerr << "EGL Has No Surfaceless Platform!" << std::endl;
+        return false;
+    }
+    PFNEGLGETPLATFORMDISPLAYEXTPROC getPlatformDisplay {(PFNEGLGETPLATFORMDISPLAYEXTPROC)eglGetProcAddress("eglGetPlatformDisplayEXT")};
+    if(getPlatformDisplay == nullptr) return false;
+    context.eglDisplay = getPlatformDisplay(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, nullptr);
+    EGLint major, minor;
+    if(context.eglDisplay == EGL_NO_DISPLAY || !eglInitialize(context.eglDisplay, &major, &minor)) {
+        std::cerr << "Failed to Initialize The Surfaceless EGL Display!" << std::endl;
+        return false;
+    }
+    if(!hasExtension(eglQueryString(context.eglDisplay, EGL_EXTENSIONS), "EGL_KHR_surfaceless_context") || !eglBindAPI(EGL_OPENGL_API)) {
+        std::cerr << "EGL Can't Make Desktop OpenGL Contexts Current Without A Surface!" << std::endl;
+        return false;
+    }
+
+    // Any Desktop OpenGL Config - No Surface Type is Required Since None is Ever Created
+    const EGLint configAttributes[] {EGL_SURFACE_TYPE, 0, EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT, EGL_NONE};
+    EGLConfig config;
+    EGLint configCount {0};
+    if(!eglChooseConfig(context.eglDisplay, configAttributes, &config, 1, &configCount) || configCount == 0) {
+        std::cerr << "No EGL Config Supports Desktop OpenGL!" << std::endl;
+        return false;
+    }
+    for(const int* version : contextVersions) {
+        const EGLint contextAttributes[] {EGL_CONTEXT_MAJOR_VERSION, version[0], EGL_CONTEXT_MINOR_VERSION, version[1], EGL_CONTEXT_OPENGL_PROFILE_MASK, EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT, EGL_NONE};
+        context.eglContext = eglCreateContext(context.eglDisplay, config, EGL_NO_CONTEXT, contextAttributes);
+        if(context.eglContext != EGL_NO_CONTEXT) break;
+    }
+    if(context.eglContext == EGL_NO_CONTEXT || !eglMakeCurrent(context.eglDisplay, EGL_NO_SURFACE, EGL_NO_SURFACE, context.eglContext)) {
+        std::cerr << "Failed to Create An OpenGL 4.5+ Core EGL Context!" << std::endl;
+        return false;
+    }
+    return gladLoadGL((GLADloadfunc)eglGetProcAddress) != 0;
+}
+
+// Create A Context - OSMesa First, Then Surfaceless EGL
+bool createOffscreenContext(OffscreenContext &context, const char* name) {
+    if(createOSMesaContext(context, name) || createSurfacelessEGLContext(context)) return true;
+    std::cerr << "Failed to Create An Offscreen OpenGL Context - Install libOSMesa or A Mesa EGL Driver!" << std::endl;
+    destroyOffscreenContext(context);
+    return false;
+}
+
+// Destroy The Context
+void destroyOffscreenContext(OffscreenContext &context) {
+    if(context.window != nullptr) glfwDestroyWindow(context.window);
+    if(context.eglDisplay != EGL_NO_DISPLAY) {
+        eglMakeCurrent(context.eglDisplay, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+        if(context.eglContext != EGL_NO_CONTEXT) eglDestroyContext(context.eglDisplay, context.eglContext);
+        eglTerminate(context.eglDisplay);
+    }
+    glfwTerminate();
+    context = OffscreenContext();
+}
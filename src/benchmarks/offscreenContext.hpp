@@ -0,0 +1,26 @@
+// GLAD OpenGL 4.6 Loader
+#include<glad/gl.h>
+
+// GLFW
+#define GLFW_INCLUDE_NONE
+#include<GLFW/glfw3.h>
+
+// EGL - Without The X11 Types, Nothing Here Talks to A Display Server
+#define EGL_NO_X11
+#include<EGL/egl.h>
+#include<EGL/eglext.h>
+
+// Offscreen Context - An OpenGL 4.5+ Core Context Without A Window For Benchmarks on Headless Machines
+// OSMesa Through GLFW's Null Platform When libOSMesa is Installed, Otherwise EGL on Mesa's Surfaceless Platform Made Current Without Any Surface
+// There is No Default Framebuffer Either Way, Benchmarks Render Into Their Own Targets
+struct OffscreenContext {
+    GLFWwindow* window {nullptr};
+    EGLDisplay eglDisplay {EGL_NO_DISPLAY};
+    EGLContext eglContext {EGL_NO_CONTEXT};
+};
+
+// Create A Context, Make It Current and Load OpenGL - Prints Why and Returns False if No Path Works
+bool createOffscreenContext(OffscreenContext &context, const char* name);
+
+// Destroy The Context and Terminate GLFW
+void destroyOffscreenContext(OffscreenContext &context);
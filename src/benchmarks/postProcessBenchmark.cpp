@@ -0,0 +1,183 @@
+// Standard Headers
+#include<iostream>
+#include<iomanip>
+#include<fstream>
+#include<chrono>
+#include<cstdlib>
+#include<string>
+#include<random>
+
+// Custom Engine Headers
+#include"../Engine/Engine.hpp"
+#include"offscreenContext.hpp"
+
+// Resolutions Every Backend is Timed At
+struct Resolution {
+    const char* name;
+    unsigned int width, height;
+};
+const Resolution resolutions[] {
+    {"1080p", 1920, 1080},
+    {"4K", 3840, 2160}
+};
+
+// Backends Compared
+const sgl::PostProcessBackend backends[] {sgl::PostProcessBackend::FragmentBackend, sgl::PostProcessBackend::ComputeBackend};
+const char* backendNames[] {"fragment", "compute"};
+
+// Milliseconds Between Two Time Points
+static double elapsedMilliseconds(const std::chrono::steady_clock::time_point &start, const std::chrono::steady_clock::time_point &end) {
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+// Nearest Rank Percentile of Sorted Values
+static double percentile(const std::vector<double> &sortedValues, const double &fraction) {
+    std::size_t rank {(std::size_t)glm::ceil(fraction * sortedValues.size())};
+    return sortedValues[std::clamp<std::size_t>(rank, 1, sortedValues.size()) - 1];
+}
+
+// Main
+int main(int argc, char** argv) {
+    // Benchmark Config - Overridden From The Command Line
+    std::string effectName {"blur"}, outputPath;
+    int frameCount {200}, warmupFrames {20};
+    unsigned int blurRadius {16};
+    for(int i {1}; i + 1 < argc; i += 2) {
+        std::string option {argv[i]}, value {argv[i + 1]};
+        if(option == "--effect") effectName = value;
+        else if(option == "--frames") frameCount = std::max(std::atoi(value.c_str()), 1);
+        else if(option == "--warmup") warmupFrames = std::max(std::atoi(value.c_str()), 0);
+        else if(option == "--radius") blurRadius = std::clamp(std::atoi(value.c_str()), 0, 32);
+        else if(option == "--output") outputPath = value;
+        else {
+            std::cerr << "Usage: postProcessBenchmark [--effect blur|bloom] [--frames N] [--warmup N] [--radius 0-32] [--output FILE]" << std::endl;
+            return EXIT_FAILURE;
+        }
+    }
+    if(effectName != "blur" && effectName != "bloom") {
+        std::cerr << "Unknown Effect!" << std::endl;
+        return EXIT_FAILURE;
+    }
+    const sgl::PostProcessEffect effect {effectName == "blur" ? sgl::PostProcessEffect::BlurEffect : sgl::PostProcessEffect::BloomEffect};
+
+    // Offscreen Context - Vsync Never Applies, Frames Are Timed as Fast as They Render
+    OffscreenContext context;
+    if(!createOffscreenContext(context, "postProcessBenchmark")) return EXIT_FAILURE;
+
+    // Elapsed Time Query Around Each Frame's Passes
+    GLuint timeQuery;
+    glGenQueries(1, &timeQuery);
+
+    // JSON Report Header
+    std::ostringstream json;
+    json << std::fixed << std::setprecision(4);
+    json << "{\n";
+    json << "  \"effect\": \"" << effectName << "\",\n";
+    json << "  \"blurRadius\": " << blurRadius << ",\n";
+    json << "  \"frames\": " << frameCount << ",\n";
+    json << "  \"renderer\": \"" << (const char*)glGetString(GL_RENDERER) << "\",\n";
+    json << "  \"results\": [";
+
+    bool firstResult {true};
+    for(const Resolution &resolution : resolutions) {
+        const glm::uvec2 size {resolution.width, resolution.height};
+
+        // Input Filled With Noise So Every Tap Reads Distinct Values, Output Writable as An Image So Compute Blurs Write It Directly
+        sgl::RenderTargetPool renderTargetPool(1);
+        sgl::RenderTarget* inputTarget {renderTargetPool.acquire({size.x, size.y, GL_RGBA8, 0, 0})};
+        sgl::RenderTarget* outputTarget {renderTargetPool.acquire({size.x, size.y, GL_RGBA8, 0, 0})};
+        {
+            std::mt19937 random(1234);
+            std::vector<std::uint8_t> noise((std::size_t)size.x * size.y * 4);
+            for(std::uint8_t &value : noise) value = random() & 0xFF;
+            glBindTexture(GL_TEXTURE_2D, inputTarget->colorTexture);
+            glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, size.x, size.y, GL_RGBA, GL_UNSIGNED_BYTE, noise.data());
+            glBindTexture(GL_TEXTURE_2D, 0);
+        }
+
+        for(unsigned int backend {0}; backend < 2; backend++) {
+            // Chain Running Only The Benchmarked Effect
+            sgl::PostProcessChain postProcessChain("../src/shaders/postProcessingShaders");
+            sgl::PostProcessSettings settings;
+            settings.blurRadius = blurRadius;
+            postProcessChain.setSettings(settings);
+            postProcessChain.setEffects({effect});
+            postProcessChain.setEffectBackend(effect, backends[backend]);
+            sgl::RenderGraph renderGraph(renderTargetPool);
+
+            // Time Frames - The Query Result is Waited For, So Frames Don't Overlap
+            std::vector<double> gpuTimes, cpuTimes;
+            unsigned int passCount {0};
+            for(int frame {0}; frame < warmupFrames + frameCount; frame++) {
+                renderTargetPool.beginFrame();
+                const sgl::RenderGraphResource input {renderGraph.importResource("Input", *inputTarget)};
+                const sgl::RenderGraphResource output {renderGraph.importResource("Output", *outputTarget)};
+                postProcessChain.addPasses(renderGraph, input, size, output, size);
+                renderGraph.compile();
+
+                std::chrono::steady_clock::time_point start {std::chrono::steady_clock::now()};
+                glBeginQuery(GL_TIME_ELAPSED, timeQuery);
+                renderGraph.execute(nullptr);
+                glEndQuery(GL_TIME_ELAPSED);
+                std::chrono::steady_clock::time_point end {std::chrono::steady_clock::now()};
+                passCount = renderGraph.getStats().passes - renderGraph.getStats().culledPasses;
+                renderGraph.reset();
+
+                // Programs Are Built on First Use - Timings of Passes Without Them Measure Nothing
+                if(sgl::getFailedShaderProgramCount() != 0) {
+                    std::cerr << "Shader Programs Failed to Build on " << (const char*)glGetString(GL_VERSION) << ", No Report Written!" << std::endl;
+                    postProcessChain.destroy();
+                    renderTargetPool.destroy();
+                    glDeleteQueries(1, &timeQuery);
+                    destroyOffscreenContext(context);
+                    return EXIT_FAILURE;
+                }
+
+                GLuint64 elapsed {0};
+                glGetQueryObjectui64v(timeQuery, GL_QUERY_RESULT, &elapsed);
+                if(frame < warmupFrames) continue;
+                gpuTimes.push_back(elapsed / 1000000.0);
+                cpuTimes.push_back(elapsedMilliseconds(start, end));
+            }
+            postProcessChain.destroy();
+
+            // Theoretical Texture Fetches Per Output Pixel of The Blur - Derived From The Kernel and Workgroup Size, Not Counted on The GPU
+            // Fragment Taps Every Texel, Compute Loads Each Workgroup's Texels and Apron Once
+            double theoreticalFetchesPerPixel {0.0};
+            if(effect == sgl::PostProcessEffect::BlurEffect) {
+                theoreticalFetchesPerPixel = backends[backend] == sgl::PostProcessBackend::ComputeBackend ? 2.0 * (128.0 + 2.0 * blurRadius) / 128.0 : 2.0 * (2.0 * blurRadius + 1.0);
+            }
+
+            // Report
+            double gpuSum {0.0}, cpuSum {0.0};
+            for(double time : gpuTimes) gpuSum += time;
+            for(double time : cpuTimes) cpuSum += time;
+            std::sort(gpuTimes.begin(), gpuTimes.end());
+            json << (firstResult ? "\n" : ",\n");
+            json << "    {\"resolution\": \"" << resolution.name << "\", \"backend\": \"" << backendNames[backend] << "\", \"passes\": " << passCount;
+            json << ", \"gpuTimeMs\": {\"mean\": " << gpuSum / gpuTimes.size() << ", \"p50\": " << percentile(gpuTimes, 0.50) << ", \"p95\": " << percentile(gpuTimes, 0.95) << "}";
+            json << ", \"cpuTimeMs\": " << cpuSum / cpuTimes.size();
+            if(effect == sgl::PostProcessEffect::BlurEffect) json << ", \"theoreticalFetchesPerPixel\": " << theoreticalFetchesPerPixel;
+            json << "}";
+            firstResult = false;
+        }
+        renderTargetPool.destroy();
+    }
+    json << "\n  ]\n}\n";
+    if(outputPath.empty()) {
+        std::cout << json.str();
+    } else {
+        std::ofstream outputFile(outputPath);
+        outputFile << json.str();
+        if(!outputFile) {
+            std::cerr << "Failed to Write Benchmark Report!" << std::endl;
+        }
+    }
+
+    // Destroy Everything
+    glDeleteQueries(1, &timeQuery);
+    destroyOffscreenContext(context);
+
+    // Return Successful Exit Code
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,296 @@
+// Standard Headers
+#include<iostream>
+#include<iomanip>
+#include<fstream>
+#include<chrono>
+#include<cstdlib>
+#include<string>
+
+// Custom Engine Headers
+#include"../Engine/Engine.hpp"
+#include"offscreenContext.hpp"
+
+// Scene Presets - What Gets Loaded and Rendered
+struct SceneConfig {
+    std::string name;
+    bool testModel;
+    int cubeFieldSize;
+    bool occlusionCulling;
+};
+const SceneConfig scenes[] {
+    {"backpack", true, 0, false},
+    {"cubeField", false, 64, true},
+    {"denseCubeField", false, 256, true},
+    {"combined", true, 64, true}
+};
+
+// Camera Paths - Position and Look Target at Path Time t in [0, 1]
+struct CameraPose {
+    glm::vec3 position, target;
+};
+static bool cameraPathPose(const std::string &path, const float &t, CameraPose &pose) {
+    const float tau {6.2831853f};
+    if(path == "orbit") {
+        // Circle The Origin Once at Head Height
+        pose.position = glm::vec3(glm::cos(t * tau) * 6.0f, 1.5f, glm::sin(t * tau) * 6.0f);
+        pose.target = glm::vec3(0.0f);
+    } else if(path == "flyover") {
+        // Diagonal Pass Over The Cube Field, Looking Ahead and Down
+        pose.position = glm::mix(glm::vec3(-90.0f, 4.0f, -90.0f), glm::vec3(90.0f, 4.0f, 90.0f), t);
+        pose.target = pose.position + glm::vec3(1.0f, -0.3f, 1.0f);
+    } else if(path == "static") {
+        // The Interactive Demo's Start Position
+        pose.position = glm::vec3(0.0f, 0.0f, 3.0f);
+        pose.target = glm::vec3(0.0f, 0.0f, 2.0f);
+    } else {
+        return false;
+    }
+    return true;
+}
+
+// CPU Subsystems Timed Every Frame
+enum Subsystem {UpdateSubsystem, RenderQueueSubsystem, CubeFieldSubsystem, GPUWaitSubsystem, SubsystemCount};
+const char* subsystemNames[SubsystemCount] {"update", "renderQueue", "cubeField", "gpuWait"};
+
+// Per Frame Measurements
+struct FrameSample {
+    double frameTime;
+    double subsystemTimes[SubsystemCount];
+    sgl::RenderQueueStats renderStats;
+    sgl::CullStats cullStats;
+};
+
+// Milliseconds Between Two Time Points
+static double elapsedMilliseconds(const std::chrono::steady_clock::time_point &start, const std::chrono::steady_clock::time_point &end) {
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+// Nearest Rank Percentile of Sorted Values
+static double percentile(const std::vector<double> &sortedValues, const double &fraction) {
+    std::size_t rank {(std::size_t)glm::ceil(fraction * sortedValues.size())};
+    return sortedValues[std::clamp<std::size_t>(rank, 1, sortedValues.size()) - 1];
+}
+
+// Escape A String For JSON Output
+static std::string jsonString(const std::string &value) {
+    std::string escaped {"\""};
+    for(char character : value) {
+        if(character == '"' || character == '\\') escaped += '\\';
+        if((unsigned char)character >= 0x20) escaped += character;
+    }
+    return escaped + "\"";
+}
+
+// Main
+int main(int argc, char** argv) {
+    // Benchmark Config - Overridden From The Command Line
+    std::string sceneName {"combined"}, cameraPath {"orbit"}, outputPath;
+    int frameCount {600}, warmupFrames {30}, width {1920}, height {1080};
+    for(int i {1}; i + 1 < argc; i += 2) {
+        std::string option {argv[i]}, value {argv[i + 1]};
+        if(option == "--scene") sceneName = value;
+        else if(option == "--path") cameraPath = value;
+        else if(option == "--frames") frameCount = std::max(std::atoi(value.c_str()), 1);
+        else if(option == "--warmup") warmupFrames = std::max(std::atoi(value.c_str()), 0);
+        else if(option == "--width") width = std::max(std::atoi(value.c_str()), 1);
+        else if(option == "--height") height = std::max(std::atoi(value.c_str()), 1);
+        else if(option == "--output") outputPath = value;
+        else {
+            std::cerr << "Usage: renderBenchmark [--scene backpack|cubeField|denseCubeField|combined] [--path orbit|flyover|static] [--frames N] [--warmup N] [--width W] [--height H] [--output FILE]" << std::endl;
+            return EXIT_FAILURE;
+        }
+    }
+    const SceneConfig* scene {nullptr};
+    for(const SceneConfig &sceneConfig : scenes) {
+        if(sceneConfig.name == sceneName) scene = &sceneConfig;
+    }
+    CameraPose pose;
+    if(scene == nullptr || !cameraPathPose(cameraPath, 0.0f, pose)) {
+        std::cerr << "Unknown Scene or Camera Path!" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    // Offscreen Context - Vsync Never Applies, Frames Are Timed as Fast as They Render
+    OffscreenContext context;
+    if(!createOffscreenContext(context, "renderBenchmark")) return EXIT_FAILURE;
+    glEnable(GL_DEPTH_TEST);
+    glDepthFunc(GL_LESS);
+    glViewport(0, 0, width, height);
+
+    // Job System and Scene Models
+    sgl::JobSystem jobSystem(0);
+    sgl::ModelBakeSettings compactBakeSettings;
+    compactBakeSettings.jobSystem = &jobSystem;
+    compactBakeSettings.vertexFormat = sgl::VertexFormat::Compact;
+    compactBakeSettings.splitFor16BitIndices = true;
+    compactBakeSettings.lodLevels = 3;
+    compactBakeSettings.buildMeshlets = true;
+    sgl::Model cubeModel("../assets/models/cube.obj", aiProcess_FlipUVs | aiProcess_OptimizeMeshes | aiProcess_OptimizeGraph);
+    std::unique_ptr<sgl::Model> testModel;
+    if(scene->testModel) {
+        testModel = std::make_unique<sgl::Model>("../assets/models/survival_backpack/backpack.obj", aiProcess_Triangulate | aiProcess_JoinIdenticalVertices | aiProcess_FlipUVs, compactBakeSettings);
+    }
+
+    // Shaders
+    sgl::Shader testShaders;
+    testShaders.attachShader("../src/shaders/testShaders/vertexShader.glsl", sgl::ShaderType::VertexShader);
+    testShaders.attachShader("../src/shaders/testShaders/fragmentShader.glsl", sgl::ShaderType::FragmentShader);
+    testShaders.link();
+    sgl::Shader instancedShaders;
+    instancedShaders.attachShader("../src/shaders/instancedShaders/vertexShader.glsl", sgl::ShaderType::VertexShader);
+    instancedShaders.attachShader("../src/shaders/instancedShaders/fragmentShader.glsl", sgl::ShaderType::FragmentShader);
+    instancedShaders.link();
+
+    // GPU Culled Cube Field
+    sgl::GPUCuller cubeFieldCuller("../src/shaders/cullingShaders/computeShader.glsl");
+    {
+        std::vector<glm::mat4> cubeFieldMatrices;
+        for(int x {-scene->cubeFieldSize / 2}; x < scene->cubeFieldSize / 2; x++) {
+            for(int z {-scene->cubeFieldSize / 2}; z < scene->cubeFieldSize / 2; z++) {
+                cubeFieldMatrices.push_back(glm::translate(glm::mat4(1.0f), glm::vec3(x * 3.0f, -3.0f, z * 3.0f)));
+            }
+        }
+        cubeFieldCuller.setInstances(cubeFieldMatrices);
+    }
+
+    // Scene Framebuffer - Single Sampled With A Depth Texture So The Hi-Z Pyramid Builds Straight From It
+    sgl::Framebuffer sceneFb(width, height, false, 0);
+    sceneFb.createColorBufferTex();
+    sceneFb.createDepthStencilTex(GL_DEPTH24_STENCIL8);
+    sgl::HiZPyramid hiZPyramid("../src/shaders/hiZShaders/computeShader.glsl", width, height);
+    auto destroyAll {[&](void) {
+        jobSystem.destroy();
+        cubeModel.destroy();
+        if(testModel) testModel->destroy();
+        testShaders.destroy();
+        instancedShaders.destroy();
+        cubeFieldCuller.destroy();
+        hiZPyramid.destroy();
+        sceneFb.destroy(false);
+        destroyOffscreenContext(context);
+    }};
+
+    // Frames Rendered Without A Program or The Scene's Model Measure Nothing - Fail Instead of Reporting Them
+    if(sgl::getFailedShaderProgramCount() != 0 || (testModel && testModel->getMeshes().empty()) || cubeModel.getMeshes().empty()) {
+        std::cerr << "Shader Programs or Models Failed to Load on " << (const char*)glGetString(GL_VERSION) << ", No Report Written!" << std::endl;
+        destroyAll();
+        return EXIT_FAILURE;
+    }
+
+    // Render Frames Along The Camera Path
+    sgl::RenderQueue renderQueue;
+    glm::mat4 projectionMatrix {glm::perspective(glm::radians(70.0f), (float)width / (float)height, 0.1f, 100.0f)};
+    std::vector<FrameSample> samples;
+    samples.reserve(frameCount);
+    for(int frame {0}; frame < warmupFrames + frameCount; frame++) {
+        FrameSample sample {};
+        std::chrono::steady_clock::time_point frameStart {std::chrono::steady_clock::now()};
+
+        // Update - Camera, Level of Detail Selection, Culling and Render Queue Submission
+        cameraPathPose(cameraPath, frame < warmupFrames ? 0.0f : (float)(frame - warmupFrames) / (float)frameCount, pose);
+        glm::mat4 pv {projectionMatrix * glm::lookAt(pose.position, pose.target, glm::vec3(0.0f, 1.0f, 0.0f))};
+        if(testModel) {
+            testModel->selectLODs(pose.position, 70.0f, height, 1.0f);
+            testModel->submit(jobSystem, renderQueue, sgl::RenderPass::Opaque, testShaders, pv, glm::mat4(1.0f), pose.position, sample.cullStats);
+        }
+        std::chrono::steady_clock::time_point updateEnd {std::chrono::steady_clock::now()};
+
+        // Render Queue - Sort and Draw
+        sceneFb.bind(GL_FRAMEBUFFER);
+        glEnable(GL_DEPTH_TEST);
+        glClearColor(0.2f, 0.3f, 0.3f, 1.0f);
+        glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+        renderQueue.execute();
+        sample.renderStats = renderQueue.getStats();
+        std::chrono::steady_clock::time_point renderQueueEnd {std::chrono::steady_clock::now()};
+
+        // Cube Field - GPU Culling, Optionally Two-Phase Against The Hi-Z Pyramid
+        if(scene->cubeFieldSize > 0) {
+            sgl::Mesh &cubeMesh {cubeModel.getMeshes()[0]};
+            instancedShaders.use();
+            instancedShaders.setMat4("pv", pv);
+            instancedShaders.setVec3("lightDirection", -0.3f, -1.0f, -0.5f);
+            instancedShaders.setVec3("baseColor", 0.8f, 0.6f, 0.4f);
+            if(scene->occlusionCulling) {
+                cubeFieldCuller.cull(cubeMesh, pv, sgl::CullPhase::LastFrameVisible, hiZPyramid);
+                cubeFieldCuller.render(cubeMesh, instancedShaders);
+                hiZPyramid.build(sceneFb);
+                cubeFieldCuller.cull(cubeMesh, pv, sgl::CullPhase::OcclusionRetest, hiZPyramid);
+                cubeFieldCuller.render(cubeMesh, instancedShaders);
+            } else {
+                cubeFieldCuller.cull(cubeMesh, pv);
+                cubeFieldCuller.render(cubeMesh, instancedShaders);
+            }
+        }
+        sceneFb.unbind();
+        std::chrono::steady_clock::time_point cubeFieldEnd {std::chrono::steady_clock::now()};
+
+        // Wait For The GPU - Nothing is Presented, So glFinish Bounds The Frame
+        glFinish();
+        std::chrono::steady_clock::time_point frameEnd {std::chrono::steady_clock::now()};
+
+        // Record Measurements After Warming Up
+        if(frame < warmupFrames) continue;
+        sample.frameTime = elapsedMilliseconds(frameStart, frameEnd);
+        sample.subsystemTimes[UpdateSubsystem] = elapsedMilliseconds(frameStart, updateEnd);
+        sample.subsystemTimes[RenderQueueSubsystem] = elapsedMilliseconds(updateEnd, renderQueueEnd);
+        sample.subsystemTimes[CubeFieldSubsystem] = elapsedMilliseconds(renderQueueEnd, cubeFieldEnd);
+        sample.subsystemTimes[GPUWaitSubsystem] = elapsedMilliseconds(cubeFieldEnd, frameEnd);
+        samples.push_back(sample);
+    }
+
+    // Frame Time Percentiles and Per Frame Averages
+    std::vector<double> frameTimes;
+    double frameTimeSum {0.0}, subsystemSums[SubsystemCount] {};
+    double drawCalls {0.0}, shaderChanges {0.0}, materialChanges {0.0}, vertexArrayChanges {0.0};
+    double meshesVisible {0.0}, meshesCulled {0.0}, clustersVisible {0.0}, clustersCulled {0.0};
+    for(const FrameSample &sample : samples) {
+        frameTimes.push_back(sample.frameTime);
+        frameTimeSum += sample.frameTime;
+        for(int subsystem {0}; subsystem < SubsystemCount; subsystem++) subsystemSums[subsystem] += sample.subsystemTimes[subsystem];
+        drawCalls += sample.renderStats.drawCalls;
+        shaderChanges += sample.renderStats.sorted.shaderChanges;
+        materialChanges += sample.renderStats.sorted.materialChanges;
+        vertexArrayChanges += sample.renderStats.sorted.vertexArrayChanges;
+        meshesVisible += sample.cullStats.visible;
+        meshesCulled += sample.cullStats.culled;
+        clustersVisible += sample.cullStats.clustersVisible;
+        clustersCulled += sample.cullStats.clustersCulled;
+    }
+    std::sort(frameTimes.begin(), frameTimes.end());
+    const double frames {(double)samples.size()};
+
+    // JSON Report
+    std::ostringstream json;
+    json << std::fixed << std::setprecision(4);
+    json << "{\n";
+    json << "  \"scene\": " << jsonString(scene->name) << ",\n";
+    json << "  \"cameraPath\": " << jsonString(cameraPath) << ",\n";
+    json << "  \"frames\": " << samples.size() << ",\n";
+    json << "  \"width\": " << width << ",\n";
+    json << "  \"height\": " << height << ",\n";
+    json << "  \"renderer\": " << jsonString((const char*)glGetString(GL_RENDERER)) << ",\n";
+    json << "  \"glVersion\": " << jsonString((const char*)glGetString(GL_VERSION)) << ",\n";
+    json << "  \"frameTimeMs\": {\"mean\": " << frameTimeSum / frames << ", \"p50\": " << percentile(frameTimes, 0.50) << ", \"p95\": " << percentile(frameTimes, 0.95) << ", \"p99\": " << percentile(frameTimes, 0.99) << ", \"max\": " << frameTimes.back() << "},\n";
+    json << "  \"cpuTimeMs\": {";
+    for(int subsystem {0}; subsystem < SubsystemCount; subsystem++) {
+        json << (subsystem > 0 ? ", " : "") << jsonString(subsystemNames[subsystem]) << ": " << subsystemSums[subsystem] / frames;
+    }
+    json << "},\n";
+    json << "  \"perFrame\": {\"drawCalls\": " << drawCalls / frames << ", \"shaderChanges\": " << shaderChanges / frames << ", \"materialChanges\": " << materialChanges / frames << ", \"vertexArrayChanges\": " << vertexArrayChanges / frames;
+    json << ", \"meshesVisible\": " << meshesVisible / frames << ", \"meshesCulled\": " << meshesCulled / frames << ", \"clustersVisible\": " << clustersVisible / frames << ", \"clustersCulled\": " << clustersCulled / frames << "}\n";
+    json << "}\n";
+    if(outputPath.empty()) {
+        std::cout << json.str();
+    } else {
+        std::ofstream outputFile(outputPath);
+        outputFile << json.str();
+        if(!outputFile) {
+            std::cerr << "Failed to Write Benchmark Report!" << std::endl;
+        }
+    }
+
+    // Destroy Everything and Return Successful Exit Code
+    destroyAll();
+    return EXIT_SUCCESS;
+}
@@ -4,7 +4,6 @@
 #include<cstdlib>
 
 // Custom Engine Headers
-#define STB_IMAGE_IMPLEMENTATION
 #include"Engine/Engine.hpp"
 
 // Function Forward Declerations
@@ -12,28 +11,100 @@ static void ErrorCallback(int errorCode, const char* errorDesc);
 static void FramebufferSizeCallback(GLFWwindow*, int newWinWidth, int newWinHeight);
 static void MouseCallback(GLFWwindow*, double mousePosX, double mousePosY);
 static void ScrollCallback(GLFWwindow*, double, double scrollPosY);
-static void processKeyboardInput(GLFWwindow* win);
+static void MouseButtonCallback(GLFWwindow*, int button, int action, int);
+static void processKeyboardInput(GLFWwindow* win, sgl::FrameInput &input);
 
 // Variables
 // General Config
-const bool vsyncEnabled {true}, msaaEnabled {true};
+const bool vsyncEnabled {true};
+
+// Anti-Aliasing Config - None, MSAA With msaaSamples Samples, FXAA, SMAA 1x or TAA, F7 Cycles Through Them
+const sgl::AntiAliasingMode antiAliasingMode {sgl::AntiAliasingMode::MSAAAntiAliasing};
 const unsigned int msaaSamples {4};
 
+// Render Target Config - Pooled Targets Nobody Used For This Many Frames Are Freed
+const unsigned int renderTargetIdleFrames {3};
+
+// Resolution Scaling Config - The Scene Renders at renderScale of The Window Size and is Upscaled in Post Processing
+// Dynamic Resolution Instead Moves The Scale Between The Minimum and renderScale to Hold The Target GPU Frame Time (Milliseconds)
+const float renderScale {1.0f};
+const bool dynamicResolutionEnabled {false};
+const float dynamicResolutionMinScale {0.5f};
+const double dynamicResolutionTargetFrameTime {1000.0 / 60.0};
+
+// Post Processing Config - Effects in The Order They Run, Any of Tonemap, Color Grade, Vignette, FXAA, Sharpen, Blur and Bloom
+// Blur and Bloom Run as Compute Shaders or Full Screen Fragment Passes
+const std::vector<sgl::PostProcessEffect> postProcessEffects {sgl::PostProcessEffect::BloomEffect, sgl::PostProcessEffect::ColorGradeEffect, sgl::PostProcessEffect::VignetteEffect};
+const sgl::PostProcessBackend blurBackend {sgl::PostProcessBackend::ComputeBackend}, bloomBackend {sgl::PostProcessBackend::ComputeBackend};
+
+// GPU Culled Cube Field Config
+const bool cubeFieldEnabled {true};
+const int cubeFieldSize {64};
+const float cubeFieldSpacing {3.0f};
+const bool occlusionCullingEnabled {true};
+
+// Parallel Command Recording Config - Records The Test Object on Worker Threads Instead of Submitting It to The Render Queue
+const bool parallelRecordingEnabled {false};
+
+// Level of Detail Config - Largest Allowed Simplification Error in Pixels
+const float lodMaxPixelError {1.0f};
+
 // Main Window Config
 const std::string windowTitle {"LearningOpenGL"};
 int windowWidth {800}, windowHeight {600};
-float windowAspectRatio {(float)windowWidth / (float)windowHeight};
 const bool windowFullscreen {true};
 const float winBgColor[4] {0.2f, 0.3f, 0.3f, 1.0f};
 
-// Delta Time
-float lastTime, currentTime, deltaTime;
+// Frame Pipelining Config - High Throughput Updates The Next Frame on A Worker While This One Renders, F4 Toggles It
+const sgl::FramePipelineMode framePipelineMode {sgl::FramePipelineMode::LowLatency};
+
+// GPU Profiler Config - Pass Timings Are Read Back This Many Frames Late, Per Frame Timings Are Written as CSV on Exit Unless The Path is Empty
+const unsigned int gpuProfilerLatency {3};
+const std::string gpuProfileCSVPath {""};
+
+// Stats Overlay Config - Live Counters and Frame Times Drawn Over The Frame, F6 Toggles It
+const bool statsOverlayEnabled {false};
+const float statsOverlayScale {2.0f};
+
+// Trace Config - Scopes Are Recorded From Startup and Written as Chrome Trace JSON on Exit and When F5 is Pressed
+const bool tracingEnabled {false};
+const std::string traceFilePath {"sglTrace.json"};
+
+// Frame Flags - One-Shot Requests and Main Thread State Sampled Into Each Frame
+enum FrameFlags : std::uint32_t {PickRequestedFlag = 1, StatsRequestedFlag = 2, TestObjResidentFlag = 4, JitterFlag = 8};
+
+// Mouse Input - Accumulated by The Callbacks, Sampled Once Per Frame
+glm::dvec2 mousePosition {0.0};
+bool mouseMoved {false};
+double scrollOffset {0.0};
+
+// Mouse Picking - Requested by The Mouse Button Callback, Resolved in The Update Stage
+bool pickRequested {false};
+
+// Render Queue Stats - Printed Once When F3 is Pressed
+bool renderStatsRequested {false};
+
+// Frame Pipeline Mode Switch - Requested Once When F4 is Pressed
+bool pipelineModeToggleRequested {false};
+
+// Stats Overlay Switch - Requested Once When F6 is Pressed
+bool statsOverlayToggleRequested {false};
+
+// Trace Export - Requested Once When F5 is Pressed
+bool traceExportRequested {false};
+
+// Anti-Aliasing Mode Switch - Requested Once When F7 is Pressed
+bool antiAliasingCycleRequested {false};
 
 // Camera
 sgl::Camera camera(glm::vec3(0.0f, 0.0f, 3.0f), glm::vec3(0.0f, 0.0f, -1.0f), 2.5f, 0.3f, 70.0f, 0.1f, 120.0f);
 
 // Main
 int main(void) {
+    // Start Tracing Before Anything Else So Startup is Captured
+    sgl::setTracingEnabled(tracingEnabled);
+    sgl::setTraceThreadName("Main");
+
     // Set GLFW Error Callback
     glfwSetErrorCallback(ErrorCallback);
 
@@ -55,9 +126,6 @@ int main(void) {
         windowWidth = glfwGetVideoMode(glfwGetPrimaryMonitor())->width;
         windowHeight = glfwGetVideoMode(glfwGetPrimaryMonitor())->height;
 
-        // Recalculate Window Aspect Ratio
-        windowAspectRatio = (float)windowWidth / (float)windowHeight;
-
         // Create Main Window - Fullscreen and Borderless
         win = glfwCreateWindow(windowWidth, windowHeight, windowTitle.c_str(), glfwGetPrimaryMonitor(), nullptr);
     } else {
@@ -94,72 +162,49 @@ int main(void) {
     // Set GLFW Input Mode
     glfwSetInputMode(win, GLFW_CURSOR, GLFW_CURSOR_DISABLED);
 
+    // Start From The Actual Framebuffer Size - It Differs From The Window Size on High DPI Displays
+    glfwGetFramebufferSize(win, &windowWidth, &windowHeight);
+
     // Set GLFW Callbacks
     glfwSetFramebufferSizeCallback(win, FramebufferSizeCallback);
     glfwSetCursorPosCallback(win, MouseCallback);
     glfwSetScrollCallback(win, ScrollCallback);
+    glfwSetMouseButtonCallback(win, MouseButtonCallback);
 
     // Enable/Disable OpenGL Functionality
-    msaaEnabled ? glEnable(GL_MULTISAMPLE) : glDisable(GL_MULTISAMPLE);
+    glEnable(GL_MULTISAMPLE);
     glEnable(GL_DEPTH_TEST);
     glDepthFunc(GL_LESS);
 
-    // Quad Data
-    const std::vector<GLfloat> quadVertices {
-        -1.0f, -1.0f, 0.0f, 0.0f,
-        1.0f, -1.0f, 1.0f, 0.0f,
-        -1.0f, 1.0f, 0.0f, 1.0f,
-        1.0f, 1.0f, 1.0f, 1.0f
-    };
-    const std::vector<GLuint> quadIndices {
-        0, 2, 1,
-        2, 3, 1
-    };
-
-    // Quad Object
-    GLuint quadObj, quadVBO, quadIBO;
-    {
-        // Vertex Array Object
-        glGenVertexArrays(1, &quadObj);
-        glBindVertexArray(quadObj);
-
-        // Vertex Buffer Object
-        glGenBuffers(1, &quadVBO);
-        glBindBuffer(GL_ARRAY_BUFFER, quadVBO);
-        glBufferData(GL_ARRAY_BUFFER, quadVertices.size() * sizeof(GLfloat), &quadVertices[0], GL_STATIC_DRAW);
-
-        // Index/Element Buffer Object
-        glGenBuffers(1, &quadIBO);
-        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, quadIBO);
-        glBufferData(GL_ELEMENT_ARRAY_BUFFER, quadIndices.size() * sizeof(GLuint), &quadIndices[0], GL_STATIC_DRAW);
-
-        // Vertex Attributes
-        glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 4 * sizeof(GL_FLOAT), (void*)0);
-        glEnableVertexAttribArray(0);
-        glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 4 * sizeof(GL_FLOAT), (void*)(2 * sizeof(GL_FLOAT)));
-        glEnableVertexAttribArray(1);
-
-        // Unbind Vertex Array Object
-        glBindVertexArray(0);
-    }
+    // Job System - Worker Threads on All Hardware Threads But This One
+    sgl::JobSystem jobSystem(0);
 
     // Models
+    sgl::ModelBakeSettings compactBakeSettings;
+    compactBakeSettings.jobSystem = &jobSystem;
+    compactBakeSettings.vertexFormat = sgl::VertexFormat::Compact;
+    compactBakeSettings.splitFor16BitIndices = true;
+    compactBakeSettings.lodLevels = 3;
+    compactBakeSettings.buildMeshlets = true;
     sgl::Model cubeModel("../assets/models/cube.obj", aiProcess_FlipUVs | aiProcess_OptimizeMeshes | aiProcess_OptimizeGraph);
-    sgl::Model testObj("../assets/models/survival_backpack/backpack.obj", aiProcess_Triangulate | aiProcess_FlipUVs);
+
+    // Background Loaded Models - A Placeholder is Drawn Until They Become Resident
+    sgl::ModelLoader modelLoader(win);
+    sgl::ModelHandle testObj {modelLoader.load("../assets/models/survival_backpack/backpack.obj", aiProcess_Triangulate | aiProcess_JoinIdenticalVertices | aiProcess_FlipUVs, compactBakeSettings)};
     
     // Shaders
-    // Post Processing Shaders
-    sgl::Shader postProcessingShaders;
-    postProcessingShaders.attachShader("../src/shaders/postProcessingShaders/vertexShader.glsl", sgl::ShaderType::VertexShader);
-    postProcessingShaders.attachShader("../src/shaders/postProcessingShaders/fragmentShader.glsl", sgl::ShaderType::FragmentShader);
-    postProcessingShaders.link();
-
     // Skybox Shaders
     sgl::Shader skyboxShaders;
     skyboxShaders.attachShader("../src/shaders/skyboxShaders/vertexShader.glsl", sgl::ShaderType::VertexShader);
     skyboxShaders.attachShader("../src/shaders/skyboxShaders/fragmentShader.glsl", sgl::ShaderType::FragmentShader);
     skyboxShaders.link();
 
+    // Instanced Shaders
+    sgl::Shader instancedShaders;
+    instancedShaders.attachShader("../src/shaders/instancedShaders/vertexShader.glsl", sgl::ShaderType::VertexShader);
+    instancedShaders.attachShader("../src/shaders/instancedShaders/fragmentShader.glsl", sgl::ShaderType::FragmentShader);
+    instancedShaders.link();
+
     // Test Shaders
     sgl::Shader testShaders;
     testShaders.attachShader("../src/shaders/testShaders/vertexShader.glsl", sgl::ShaderType::VertexShader);
@@ -186,51 +231,226 @@ int main(void) {
     skyboxTexture.setParameteri(GL_TEXTURE_WRAP_R, GL_CLAMP_TO_EDGE);
     skyboxTexture.unbind();
 
-    // Framebuffers
-    // MSAA Framebuffer
-    sgl::Framebuffer msaaFb(windowWidth, windowHeight, true, msaaSamples);
-    msaaFb.createColorBufferTex();
-    msaaFb.createRenderbuffer(GL_DEPTH24_STENCIL8);
-
-    // Post-Processing Framebuffer
-    sgl::Framebuffer postProcessFb(windowWidth, windowHeight, false, 0);
-    postProcessFb.createColorBufferTex();
-
-    // Model and Projection Matrix
-    glm::mat4 modelMatrix, projectionMatrix;
-
-    // Main Loop
-    while(!glfwWindowShouldClose(win)) {
-        // Swap Buffers
-        glfwSwapBuffers(win);
-
-        // Bind MSAA Framebuffer
-        msaaFb.bind(GL_FRAMEBUFFER);
-
-        // Clear Post Processing Framebuffer
-        glEnable(GL_DEPTH_TEST);
-        glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
-
-        // Projection Matrix
-        projectionMatrix = glm::mat4(1.0f);
-        projectionMatrix = glm::perspective(glm::radians(camera.getFOV()), windowAspectRatio, 0.1f, 100.0f);
-
-        // Render Test Object
-        {
-            // Prepare to Render Test Object
-            testShaders.use();
+    // GPU Culled Cube Field - Instances Are Culled in A Compute Shader Every Frame
+    sgl::GPUCuller cubeFieldCuller("../src/shaders/cullingShaders/computeShader.glsl");
+    {
+        std::vector<glm::mat4> cubeFieldMatrices;
+        for(int x {-cubeFieldSize / 2}; x < cubeFieldSize / 2; x++) {
+            for(int z {-cubeFieldSize / 2}; z < cubeFieldSize / 2; z++) {
+                cubeFieldMatrices.push_back(glm::translate(glm::mat4(1.0f), glm::vec3(x * cubeFieldSpacing, -3.0f, z * cubeFieldSpacing)));
+            }
+        }
+        cubeFieldCuller.setInstances(cubeFieldMatrices);
+    }
 
-            // Send Product of Projection, View and Model Matrices (In Respective Order) to Test Object's Vertex Shader
-            modelMatrix = glm::mat4(1.0f);
-            testShaders.setMat4("pvm", projectionMatrix * camera.getViewMat() * modelMatrix);
+    // Render Target Pool - Transient Targets of The Render Graph Are Acquired at The Viewport Size Every Frame
+    // Targets of Another Size Are Freed Once Unused For A Few Frames, So Resizing Recreates Them Lazily
+    sgl::RenderTargetPool renderTargetPool(renderTargetIdleFrames);
+
+    // Render Graph - Rebuilt Every Frame, Renders Into The Default Framebuffer Imported as The Backbuffer
+    sgl::RenderGraph renderGraph(renderTargetPool);
+    sgl::RenderTarget backbufferTarget;
+    backbufferTarget.desc.colorFormat = GL_RGB8;
+
+    // Hierarchical-Z Pyramid For Occlusion Culling The Cube Field - Resized Along With The Viewport
+    sgl::HiZPyramid hiZPyramid("../src/shaders/hiZShaders/computeShader.glsl", windowWidth, windowHeight);
+
+    // GPU Profiler - Times Each Render Pass on The GPU and The CPU
+    sgl::GPUProfiler gpuProfiler(gpuProfilerLatency);
+
+    // Post Processing Chain - Per Pixel Effects Are Fused Into One Pass, Bloom's Composite Included
+    sgl::PostProcessChain postProcessChain("../src/shaders/postProcessingShaders");
+    postProcessChain.setEffectBackend(sgl::PostProcessEffect::BlurEffect, blurBackend);
+    postProcessChain.setEffectBackend(sgl::PostProcessEffect::BloomEffect, bloomBackend);
+
+    // Anti-Aliasing - FXAA Runs as The First Post Processing Effect, The Other Modes Add Their Own Passes
+    sgl::AntiAliasing antiAliasing("../src/shaders/antiAliasingShaders", renderTargetPool);
+    sgl::AntiAliasingSettings antiAliasingSettings;
+    antiAliasingSettings.msaaSamples = msaaSamples;
+    antiAliasing.setSettings(antiAliasingSettings);
+    auto setAntiAliasingMode {[&](const sgl::AntiAliasingMode &mode) {
+        antiAliasing.setMode(mode);
+        std::vector<sgl::PostProcessEffect> effects {postProcessEffects};
+        if(mode == sgl::AntiAliasingMode::FXAAAntiAliasing) effects.insert(effects.begin(), sgl::PostProcessEffect::FXAAEffect);
+        postProcessChain.setEffects(effects);
+    }};
+    setAntiAliasingMode(antiAliasingMode);
+
+    // Dynamic Resolution - Judges A Scale Change Once The Profiler Has Timed Frames Rendered at It
+    sgl::DynamicResolution dynamicResolution(dynamicResolutionTargetFrameTime, dynamicResolutionMinScale, renderScale, gpuProfilerLatency + 1);
+    dynamicResolution.setEnabled(dynamicResolutionEnabled && gpuProfiler.isGPUTimingAvailable());
+
+    // Stats Overlay - Shows The Stats Merged at The End of The Previous Frame, Counting Only Runs While It's Shown
+    sgl::StatsOverlay statsOverlay("../src/shaders/overlayShaders/vertexShader.glsl", "../src/shaders/overlayShaders/fragmentShader.glsl");
+    sgl::FrameStats frameStats;
+    sgl::setStatsEnabled(statsOverlayEnabled);
+
+    // Frame Pipeline - Each Frame State Gets One Command Buffer Per Hardware Thread For Parallel Recording
+    sgl::FramePipeline framePipeline(jobSystem, framePipelineMode, std::max(std::thread::hardware_concurrency(), 1u));
+
+    // Sample Stage - Snapshot Input and Main Thread State For The Next Frame
+    auto sampleFrame {[&](sgl::FrameState &frame) {
+        SGL_PROFILE_SCOPE("Sample");
+        processKeyboardInput(win, frame.input);
+        frame.input.mousePosition = mousePosition;
+        frame.input.mouseMoved = mouseMoved;
+        frame.input.scrollOffset = scrollOffset;
+        mouseMoved = false;
+        scrollOffset = 0.0;
+        frame.viewportSize = glm::ivec2(windowWidth, windowHeight);
+
+        // Render Size at The Current Scale and Whether TAA Needs The Projection Jittered
+        frame.renderSize = dynamicResolution.getScaledSize(frame.viewportSize);
+        if(antiAliasing.getMode() == sgl::AntiAliasingMode::TAAAntiAliasing) frame.input.flags |= JitterFlag;
+
+        // One-Shot Requests and Test Object Residency - Finalizing A Loaded Model Needs The OpenGL Context
+        if(pickRequested) frame.input.flags |= PickRequestedFlag;
+        if(renderStatsRequested) frame.input.flags |= StatsRequestedFlag;
+        if(testObj.isResident()) frame.input.flags |= TestObjResidentFlag;
+        pickRequested = false;
+        renderStatsRequested = false;
+    }};
+
+    // Update Stage - Camera, Culling and Draw Building From The Sampled Input, Never Touches OpenGL
+    auto updateFrame {[&](sgl::FrameState &frame) {
+        SGL_PROFILE_SCOPE("Update");
+
+        // Camera
+        camera.processKeyboard(frame.input.movement, frame.deltaTime);
+        if(frame.input.mouseMoved) camera.processMouse(frame.input.mousePosition.x, frame.input.mousePosition.y);
+        if(frame.input.scrollOffset != 0.0) camera.processScroll(frame.input.scrollOffset);
+
+        // Projection and View Matrices - Jittered by A Sub-Pixel Offset Every Frame For TAA
+        float aspectRatio {(float)frame.viewportSize.x / (float)std::max(frame.viewportSize.y, 1)};
+        const bool jittered {(frame.input.flags & JitterFlag) != 0};
+        frame.unjitteredProjectionMatrix = camera.getProjectionMat(aspectRatio, 0.1f, 100.0f);
+        frame.projectionMatrix = jittered ? camera.getJitteredProjectionMat(aspectRatio, 0.1f, 100.0f, frame.renderSize, frame.frameIndex) : frame.unjitteredProjectionMatrix;
+        frame.jitter = jittered ? camera.getJitter(frame.frameIndex) : glm::vec2(0.0f);
+        frame.viewMatrix = camera.getViewMat();
+        frame.cameraPosition = camera.getPosition();
+
+        // Reset Culling Stats and Recorded Commands
+        frame.cullStats = sgl::CullStats();
+        for(sgl::CommandBuffer &commandBuffer : frame.commandBuffers) {
+            commandBuffer.reset();
+        }
 
-            // Render Test Object
-            testObj.render(testShaders);
+        // Model Matrix and Product of Projection and View Matrices (In Respective Order)
+        glm::mat4 modelMatrix {1.0f};
+        glm::mat4 pv {frame.projectionMatrix * frame.viewMatrix};
+
+        // Build Test Object's Draws Inside The View Frustum - Or Placeholder Cube While It's Still Loading
+        const bool testObjResident {(frame.input.flags & TestObjResidentFlag) != 0};
+        if(testObjResident) {
+            glm::vec3 modelSpaceCameraPosition {glm::inverse(modelMatrix) * glm::vec4(frame.cameraPosition, 1.0f)};
+            testObj.get().selectLODs(modelSpaceCameraPosition, camera.getFOV(), frame.renderSize.y, lodMaxPixelError);
+            if(parallelRecordingEnabled) {
+                testObj.get().recordParallel(jobSystem, frame.commandBuffers, testShaders, pv, modelMatrix, frame.cameraPosition, frame.cullStats);
+            } else {
+                testObj.get().submit(jobSystem, frame.renderQueue, sgl::RenderPass::Opaque, testShaders, pv, modelMatrix, frame.cameraPosition, frame.cullStats);
+            }
+        } else {
+            cubeModel.submit(frame.renderQueue, sgl::RenderPass::Opaque, testShaders, pv, modelMatrix, frame.cameraPosition, frame.cullStats);
         }
 
-        // Render Skybox
-        {
+        // Pick The Test Object's Mesh Under The Crosshair - Ray is Transformed Into Model Space
+        if((frame.input.flags & PickRequestedFlag) && testObjResident) {
+            glm::mat4 inverseModelMatrix {glm::inverse(modelMatrix)};
+            glm::vec3 rayOrigin {inverseModelMatrix * glm::vec4(frame.cameraPosition, 1.0f)};
+            glm::vec3 rayDirection {inverseModelMatrix * glm::vec4(camera.getFront(), 0.0f)};
+            sgl::RayHit hit;
+            if(testObj.get().raycast(rayOrigin, rayDirection, hit)) {
+                std::cout << "Picked Mesh " << hit.instance << " at Distance " << hit.distance << std::endl;
+            }
+        }
+    }};
+
+    // Render Stage - Submits A Built Frame State on The OpenGL Context Thread
+    auto renderFrame {[&](sgl::FrameState &frame) {
+        SGL_PROFILE_SCOPE("Render");
+
+        // Nothing to Render Into While Minimized
+        const glm::ivec2 viewportSize {frame.viewportSize};
+        if(viewportSize.x <= 0 || viewportSize.y <= 0) return;
+
+        // Read Back The Oldest Frame's Timings, Then Pick The Render Scale of The Frames Sampled From Now On
+        // A Dropped Readback Leaves Last Time's Timings in Place, Which Mustn't Count as Another Sample
+        const sgl::GPUPassTiming* lastFrameTiming {gpuProfiler.beginFrame() ? gpuProfiler.getPass("Frame") : nullptr};
+        if(lastFrameTiming != nullptr) dynamicResolution.update(lastFrameTiming->gpuTime);
+
+        // Resize Everything Sized to The Scaled Viewport - Pooled Targets of The Old Size Are Freed Once Idle
+        renderTargetPool.beginFrame();
+        const glm::uvec2 sceneSize {frame.renderSize};
+        const unsigned int width {sceneSize.x}, height {sceneSize.y};
+        backbufferTarget.desc.width = viewportSize.x;
+        backbufferTarget.desc.height = viewportSize.y;
+        hiZPyramid.resize(width, height);
+
+        // Render Graph Resources - Scene is Multisampled Only For MSAA, Both at The Scaled Size
+        // The Hi-Z Pyramid Reads A Single Sampled Scene's Depth Directly, A Multisampled One is Resolved Into Its Own Target First
+        const bool sceneMultisampled {antiAliasing.getSceneSamples() != 0};
+        const sgl::RenderGraphResource sceneResource {renderGraph.createResource("Scene", {width, height, GL_RGB8, GL_DEPTH24_STENCIL8, antiAliasing.getSceneSamples()})};
+        const sgl::RenderGraphResource hiZDepthResource {sceneMultisampled ? renderGraph.createResource("Depth Resolve", {width, height, 0, GL_DEPTH24_STENCIL8, 0}) : sceneResource};
+        const sgl::RenderGraphResource backbufferResource {renderGraph.importResource("Backbuffer", backbufferTarget)};
+
+        // Product of Projection and View Matrices (In Respective Order)
+        const glm::mat4 pv {frame.projectionMatrix * frame.viewMatrix};
+
+        // Scene Pass - Test Object and GPU Culled Cube Field
+        std::vector<sgl::RenderGraphAccess> sceneWrites {{sceneResource, sgl::RenderGraphUsage::ColorAttachment}, {sceneResource, sgl::RenderGraphUsage::DepthAttachment}};
+        if(cubeFieldEnabled && occlusionCullingEnabled && sceneMultisampled) sceneWrites.push_back({hiZDepthResource, sgl::RenderGraphUsage::BlitDestination});
+        renderGraph.addPass("Scene", {}, sceneWrites, [&](sgl::RenderGraph &graph) {
+            // Bind and Clear Scene Target
+            sgl::RenderTarget* sceneTarget {graph.getTarget(sceneResource)};
+            sceneTarget->bind(GL_FRAMEBUFFER);
+            glViewport(0, 0, width, height);
+            glEnable(GL_DEPTH_TEST);
+            glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+
+            // Render Test Object - Replay Recorded Command Buffers in Order, Then Sort and Render Everything Submitted
+            for(sgl::CommandBuffer &commandBuffer : frame.commandBuffers) {
+                commandBuffer.execute();
+            }
+            frame.renderQueue.execute();
+
+            // Render GPU Culled Cube Field
+            if(cubeFieldEnabled) {
+                sgl::Mesh &cubeMesh {cubeModel.getMeshes()[0]};
+                instancedShaders.use();
+                instancedShaders.setMat4("pv", pv);
+                instancedShaders.setVec3("lightDirection", -0.3f, -1.0f, -0.5f);
+                instancedShaders.setVec3("baseColor", 0.8f, 0.6f, 0.4f);
+
+                if(occlusionCullingEnabled) {
+                    // Phase 1 - Render Cubes That Were Visible Last Frame
+                    cubeFieldCuller.cull(cubeMesh, pv, sgl::CullPhase::LastFrameVisible, hiZPyramid);
+                    cubeFieldCuller.render(cubeMesh, instancedShaders);
+
+                    // Build Hi-Z Pyramid From Everything Drawn So Far - Multisampled Depth is Resolved First
+                    sgl::RenderTarget* hiZDepthTarget {graph.getTarget(hiZDepthResource)};
+                    if(sceneMultisampled) {
+                        sceneTarget->bind(GL_READ_FRAMEBUFFER);
+                        hiZDepthTarget->bind(GL_DRAW_FRAMEBUFFER);
+                        glBlitFramebuffer(0, 0, width, height, 0, 0, width, height, GL_DEPTH_BUFFER_BIT, GL_NEAREST);
+                        sceneTarget->bind(GL_FRAMEBUFFER);
+                    }
+                    hiZPyramid.build(*hiZDepthTarget);
+
+                    // Phase 2 - Retest The Rest Against The Pyramid and Render Newly Visible Cubes
+                    cubeFieldCuller.cull(cubeMesh, pv, sgl::CullPhase::OcclusionRetest, hiZPyramid);
+                    cubeFieldCuller.render(cubeMesh, instancedShaders);
+                } else {
+                    // Cull Cube Instances on The GPU and Render Visible Cube Instances
+                    cubeFieldCuller.cull(cubeMesh, pv);
+                    cubeFieldCuller.render(cubeMesh, instancedShaders);
+                }
+            }
+        });
+
+        // Skybox Pass - Depth Tested Against The Scene, Drawn Where Nothing Else Was
+        renderGraph.addPass("Skybox", {{sceneResource, sgl::RenderGraphUsage::DepthAttachment}}, {{sceneResource, sgl::RenderGraphUsage::ColorAttachment}}, [&](sgl::RenderGraph &graph) {
             // Prepare to Render Skybox
+            graph.getTarget(sceneResource)->bind(GL_FRAMEBUFFER);
             glDepthFunc(GL_LEQUAL);
             skyboxShaders.use();
 
@@ -240,78 +460,163 @@ int main(void) {
             skyboxTexture.bind();
 
             // Send Product of Just The Projection and View Matrices (In Respective Order) to Skybox Object's Vertex Shader
-            skyboxShaders.setMat4("pv", projectionMatrix * glm::mat4(glm::mat3(camera.getViewMat())));
+            skyboxShaders.setMat4("pv", frame.projectionMatrix * glm::mat4(glm::mat3(frame.viewMatrix)));
 
             // Render Skybox
             cubeModel.render(skyboxShaders);
             glDepthFunc(GL_LESS);
+        });
+
+        // Anti-Aliasing Passes - Resolve or Filter The Scene, TAA Reprojects Its History With The Unjittered View Projection
+        const sgl::RenderGraphResource antiAliasedResource {antiAliasing.addPasses(renderGraph, sceneResource, sceneSize, frame.unjitteredProjectionMatrix * frame.viewMatrix, frame.jitter)};
+
+        // Post Processing Passes - Into The Default Framebuffer, Upscaling The Scene if It Was Rendered Smaller
+        postProcessChain.addPasses(renderGraph, antiAliasedResource, sceneSize, backbufferResource, glm::uvec2(viewportSize));
+
+        // Stats Overlay Pass - Drawn Over The Post Processed Frame
+        if(sgl::isStatsEnabled()) {
+            renderGraph.addPass("Stats Overlay", {{backbufferResource, sgl::RenderGraphUsage::ColorAttachment}}, {{backbufferResource, sgl::RenderGraphUsage::ColorAttachment}}, [&](sgl::RenderGraph&) {
+                statsOverlay.draw(sgl::formatStats(frameStats), glm::vec2(8.0f), statsOverlayScale, frame.viewportSize);
+            });
+        }
+
+        // Compile and Execute The Graph - Each Pass is Timed by The GPU Profiler Inside The Frame Pass
+        gpuProfiler.beginPass("Frame");
+        renderGraph.compile();
+        renderGraph.execute(&gpuProfiler);
+        renderGraph.reset();
+
+        // Print Render Stats
+        if(frame.input.flags & StatsRequestedFlag) {
+            const sgl::RenderQueueStats &renderStats {frame.renderQueue.getStats()};
+            std::cout << "Draw Calls: " << renderStats.drawCalls;
+            std::cout << " | Shader/Material/VAO Changes Unsorted: " << renderStats.unsorted.shaderChanges << '/' << renderStats.unsorted.materialChanges << '/' << renderStats.unsorted.vertexArrayChanges;
+            std::cout << " Sorted: " << renderStats.sorted.shaderChanges << '/' << renderStats.sorted.materialChanges << '/' << renderStats.sorted.vertexArrayChanges << std::endl;
+            std::cout << (framePipeline.getMode() == sgl::FramePipelineMode::HighThroughput ? "High Throughput" : "Low Latency") << " Pipeline | Input Latency: " << framePipeline.getAverageInputLatency() * 1000.0 << " ms" << std::endl;
+            for(const sgl::GPUPassTiming &timing : gpuProfiler.getPasses()) {
+                std::cout << timing.name << " Pass | GPU: " << (gpuProfiler.isGPUTimingAvailable() ? std::to_string(timing.averageGPUTime) : "N/A") << " ms | CPU: " << timing.averageCPUTime << " ms" << std::endl;
+            }
+            std::cout << "GPU Profiler Dropped Frames: " << gpuProfiler.getDroppedFrames() << std::endl;
+            std::cout << "Anti-Aliasing: " << antiAliasing.getModeName();
+            if(antiAliasing.getSceneSamples() > 0) std::cout << ' ' << antiAliasing.getSceneSamples() << 'x';
+            std::cout << std::endl;
+            std::cout << "Post Processing: " << postProcessChain.getEffects().size() << " Effects in " << postProcessChain.getStageCount() << " Stages" << std::endl;
+            std::cout << "Render Scale: " << dynamicResolution.getScale() << " (" << width << 'x' << height << ')' << (dynamicResolution.isEnabled() ? " | Dynamic" : "") << std::endl;
+            std::cout << "Render Targets: " << renderTargetPool.getTargetCount() << " (" << renderTargetPool.getMemoryUsage() / (1024.0 * 1024.0) << " MiB) | Created: " << renderTargetPool.getCreatedCount() << std::endl;
+            const sgl::RenderGraphStats &graphStats {renderGraph.getStats()};
+            std::cout << "Render Graph Passes: " << graphStats.passes << " (" << graphStats.culledPasses << " Culled) | Transient Resources: " << graphStats.transientResources << " in " << graphStats.physicalTargets << " Targets | Barriers: " << graphStats.barriers << std::endl;
         }
 
-        // Copy Everything From MSAA Framebuffer to Post Processing Framebuffer (Downscale)
-        msaaFb.bind(GL_READ_FRAMEBUFFER);
-        postProcessFb.bind(GL_DRAW_FRAMEBUFFER);
-        glBlitFramebuffer(0, 0, windowWidth, windowHeight, 0, 0, windowWidth, windowHeight, GL_COLOR_BUFFER_BIT, GL_LINEAR);
+        gpuProfiler.endPass();
 
-        // Render Quad Object
+        // Merge This Frame's Counters For The Next One
+        if(sgl::isStatsEnabled()) {
+            const sgl::GPUPassTiming* frameTiming {gpuProfiler.getPass("Frame")};
+            frameStats = sgl::collectStats();
+            frameStats.renderCPUTime = frameTiming->averageCPUTime;
+            frameStats.gpuFrameTime = frameTiming->averageGPUTime;
+        }
+        gpuProfiler.endFrame();
+    }};
+
+    // Main Loop
+    while(!glfwWindowShouldClose(win)) {
+        // Swap Buffers
         {
-            // Bind Back to Default Framebuffer and Clear it
-            postProcessFb.unbind();
-            glDisable(GL_DEPTH_TEST);
-            glClear(GL_COLOR_BUFFER_BIT);
+            SGL_PROFILE_SCOPE("Swap Buffers");
+            glfwSwapBuffers(win);
+        }
 
-            // Prepare to Render Quad Object
-            glBindVertexArray(quadObj);
-            postProcessingShaders.use();
+        // Run Jobs Queued For The OpenGL Context Thread
+        {
+            SGL_PROFILE_SCOPE("Main Thread Jobs");
+            jobSystem.runMainThreadJobs();
+        }
 
-            // Bind Color Buffer Texture
-            postProcessingShaders.setInt("screenTexture", 0);
-            glActiveTexture(GL_TEXTURE0);
-            postProcessFb.bindColorBufferTex();
+        // Sample, Update and Render - The Update of The Next Frame Overlaps Rendering in High Throughput Mode
+        framePipeline.runFrame(sampleFrame, updateFrame, renderFrame);
 
-            // Render Quad Object
-            glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, nullptr);
+        // Switch Between Low Latency and High Throughput Pipelining
+        if(pipelineModeToggleRequested) {
+            framePipeline.setMode(framePipeline.getMode() == sgl::FramePipelineMode::LowLatency ? sgl::FramePipelineMode::HighThroughput : sgl::FramePipelineMode::LowLatency);
+            pipelineModeToggleRequested = false;
+        }
 
-            // Unbind Quad Object VAO
-            glBindVertexArray(0);
+        // Show/Hide Stats Overlay - Counters Collected While Hidden Are Dropped
+        if(statsOverlayToggleRequested) {
+            sgl::setStatsEnabled(!sgl::isStatsEnabled());
+            frameStats = sgl::collectStats();
+            statsOverlayToggleRequested = false;
         }
 
-        // Calculate Delta Time
-        currentTime = glfwGetTime();
-        deltaTime = currentTime - lastTime;
-        lastTime = currentTime;
+        // Cycle Through Anti-Aliasing Modes
+        if(antiAliasingCycleRequested) {
+            setAntiAliasingMode((sgl::AntiAliasingMode)((antiAliasing.getMode() + 1) % sgl::AntiAliasingMode::AntiAliasingModeCount));
+            std::cout << "Anti-Aliasing: " << antiAliasing.getModeName() << std::endl;
+            antiAliasingCycleRequested = false;
+        }
 
-        // Process User Keyboard Input
-        processKeyboardInput(win);
+        // Write The Trace So Far
+        if(traceExportRequested) {
+            if(sgl::isTracingEnabled() && sgl::exportChromeTrace(traceFilePath)) {
+                std::cout << "Trace Written to " << traceFilePath << std::endl;
+            }
+            traceExportRequested = false;
+        }
 
         // Poll Events
-        glfwPollEvents();
+        {
+            SGL_PROFILE_SCOPE("Poll Events");
+            glfwPollEvents();
+        }
     }
 
-    // Terminate Program
-    // Destroy Vertex Array Objects
-    glDeleteVertexArrays(1, &quadObj);
-
-    // Destroy Vertex Buffer Objects
-    glDeleteBuffers(1, &quadVBO);
+    // Finish The Update in Flight Before Tearing Anything Down
+    framePipeline.flush();
 
-    // Destroy Index/Element Buffer Objects
-    glDeleteBuffers(1, &quadIBO);
+    // Terminate Program
+    // Destroy Model Loader and Job System - The Loader May Still Be Running Bake Jobs
+    modelLoader.destroy();
+    jobSystem.destroy();
 
     // Destroy Models
     cubeModel.destroy();
-    testObj.destroy();
+    if(testObj.isResident()) {
+        testObj.get().destroy();
+    }
+
+    // Export and Destroy GPU Profiler
+    if(!gpuProfileCSVPath.empty()) {
+        gpuProfiler.exportCSV(gpuProfileCSVPath);
+    }
+    gpuProfiler.destroy();
+
+    // Destroy Stats Overlay
+    statsOverlay.destroy();
+
+    // Write The Trace - Includes The Frames Before Exit and The Startup if The Buffers Didn't Wrap Around
+    if(sgl::isTracingEnabled()) {
+        sgl::exportChromeTrace(traceFilePath);
+    }
+
+    // Destroy Post Processing Chain and Anti-Aliasing
+    postProcessChain.destroy();
+    antiAliasing.destroy();
+
+    // Destroy GPU Culler and Hi-Z Pyramid
+    cubeFieldCuller.destroy();
+    hiZPyramid.destroy();
 
     // Destroy Shaders
-    postProcessingShaders.destroy();
+    instancedShaders.destroy();
     testShaders.destroy();
     skyboxShaders.destroy();
 
     // Destroy Textures
     skyboxTexture.destroy();
 
-    // Destroy Framebuffers
-    msaaFb.destroy(true);
-    postProcessFb.destroy(false);
+    // Destroy Render Targets
+    renderTargetPool.destroy();
 
     // Destroy Main Window and Terminate GLFW
     glfwDestroyWindow(win);
@@ -323,14 +628,57 @@ int main(void) {
 }
 
 // Process User Keyboard Input
-static void processKeyboardInput(GLFWwindow* win) {
+static void processKeyboardInput(GLFWwindow* win, sgl::FrameInput &input) {
     // Escape Key Pressed - Terminate Program
     if(glfwGetKey(win, GLFW_KEY_ESCAPE) == GLFW_PRESS) {
         glfwSetWindowShouldClose(win, GLFW_TRUE);
     }
 
-    // Camera Process Keyboard Input - Move Around
-    camera.processKeyboard(win, deltaTime);
+    // F3 Key Pressed - Print Render Queue Stats Once Per Press
+    static bool statsKeyDown {false};
+    bool statsKeyPressed {glfwGetKey(win, GLFW_KEY_F3) == GLFW_PRESS};
+    if(statsKeyPressed && !statsKeyDown) {
+        renderStatsRequested = true;
+    }
+    statsKeyDown = statsKeyPressed;
+
+    // F4 Key Pressed - Switch Frame Pipeline Mode Once Per Press
+    static bool pipelineKeyDown {false};
+    bool pipelineKeyPressed {glfwGetKey(win, GLFW_KEY_F4) == GLFW_PRESS};
+    if(pipelineKeyPressed && !pipelineKeyDown) {
+        pipelineModeToggleRequested = true;
+    }
+    pipelineKeyDown = pipelineKeyPressed;
+
+    // F5 Key Pressed - Write The Trace Once Per Press
+    static bool traceKeyDown {false};
+    bool traceKeyPressed {glfwGetKey(win, GLFW_KEY_F5) == GLFW_PRESS};
+    if(traceKeyPressed && !traceKeyDown) {
+        traceExportRequested = true;
+    }
+    traceKeyDown = traceKeyPressed;
+
+    // F6 Key Pressed - Show/Hide Stats Overlay Once Per Press
+    static bool overlayKeyDown {false};
+    bool overlayKeyPressed {glfwGetKey(win, GLFW_KEY_F6) == GLFW_PRESS};
+    if(overlayKeyPressed && !overlayKeyDown) {
+        statsOverlayToggleRequested = true;
+    }
+    overlayKeyDown = overlayKeyPressed;
+
+    // F7 Key Pressed - Switch to The Next Anti-Aliasing Mode Once Per Press
+    static bool antiAliasingKeyDown {false};
+    bool antiAliasingKeyPressed {glfwGetKey(win, GLFW_KEY_F7) == GLFW_PRESS};
+    if(antiAliasingKeyPressed && !antiAliasingKeyDown) {
+        antiAliasingCycleRequested = true;
+    }
+    antiAliasingKeyDown = antiAliasingKeyPressed;
+
+    // Camera Movement Keys - Applied to The Camera in The Update Stage
+    input.movement.forward = glfwGetKey(win, GLFW_KEY_W) == GLFW_PRESS;
+    input.movement.backward = glfwGetKey(win, GLFW_KEY_S) == GLFW_PRESS;
+    input.movement.left = glfwGetKey(win, GLFW_KEY_A) == GLFW_PRESS;
+    input.movement.right = glfwGetKey(win, GLFW_KEY_D) == GLFW_PRESS;
 }
 
 // GLFW Callbacks
@@ -339,19 +687,22 @@ static void ErrorCallback(int errorCode, const char* errorDesc) {
     std::cerr << "GLFW Error " << errorCode << ": " << errorDesc << std::endl;
 }
 static void FramebufferSizeCallback(GLFWwindow*, int newWinWidth, int newWinHeight) {
-    // Resize OpenGL Render Viewport
-    glViewport(0, 0, newWinWidth, newWinHeight);
-
-    // Update Window Dimensions and Recalculate Window Aspect Ratio
+    // Update Window Dimensions - The Viewport and Render Targets Follow Them From The Next Sampled Frame
     windowWidth = newWinWidth;
     windowHeight = newWinHeight;
-    windowAspectRatio = (float)windowWidth / (float)windowHeight;
 }
 static void MouseCallback(GLFWwindow*, double mousePosX, double mousePosY) {
-    // Camera Process Mouse Movement - Look Around
-    camera.processMouse(mousePosX, mousePosY);
+    // Record Mouse Position - The Camera Looks Around in The Update Stage
+    mousePosition = glm::dvec2(mousePosX, mousePosY);
+    mouseMoved = true;
 }
 static void ScrollCallback(GLFWwindow*, double, double scrollPosY) {
-    // Camera Process Scroll - Zoom In/Out
-    camera.processScroll(scrollPosY);
+    // Accumulate Scroll - The Camera Zooms In/Out in The Update Stage
+    scrollOffset += scrollPosY;
+}
+static void MouseButtonCallback(GLFWwindow*, int button, int action, int) {
+    // Left Click - Pick Whatever is Under The Crosshair
+    if(button == GLFW_MOUSE_BUTTON_LEFT && action == GLFW_PRESS) {
+        pickRequested = true;
+    }
 }
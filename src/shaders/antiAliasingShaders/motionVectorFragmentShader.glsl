@@ -0,0 +1,39 @@
+#version 450 core
+
+// Input
+in vec2 texCords;
+
+// Uniform Variables - The Inverse is of The Jittered View Projection The Depth Was Rendered With, The Others Are Unjittered
+uniform sampler2D depthTexture;
+uniform mat4 inverseViewProjection;
+uniform mat4 viewProjection;
+uniform mat4 previousViewProjection;
+
+// Output - Texture Coordinate Offset From Where The Surface Was Last Frame to Where It is Now
+out vec2 fragColor;
+
+// Main - Motion of The Nearest Surface in The 3x3 Neighborhood, So Edges Move With The Object in Front
+void main(void) {
+    ivec2 pixel = ivec2(gl_FragCoord.xy);
+    ivec2 size = textureSize(depthTexture, 0);
+    ivec2 nearestPixel = pixel;
+    float nearestDepth = 1.0f;
+    for(int y = -1; y <= 1; y++) {
+        for(int x = -1; x <= 1; x++) {
+            ivec2 neighbor = clamp(pixel + ivec2(x, y), ivec2(0), size - 1);
+            float depth = texelFetch(depthTexture, neighbor, 0).r;
+            if(depth < nearestDepth) {
+                nearestDepth = depth;
+                nearestPixel = neighbor;
+            }
+        }
+    }
+
+    // Reconstruct The World Position and Project It Into Both Frames
+    vec2 uv = (vec2(nearestPixel) + 0.5f) / vec2(size);
+    vec4 position = inverseViewProjection * vec4(uv * 2.0f - 1.0f, nearestDepth * 2.0f - 1.0f, 1.0f);
+    position /= position.w;
+    vec4 current = viewProjection * position;
+    vec4 previous = previousViewProjection * position;
+    fragColor = (current.xy / current.w - previous.xy / previous.w) * 0.5f;
+}
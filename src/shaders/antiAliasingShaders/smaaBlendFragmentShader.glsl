@@ -0,0 +1,40 @@
+#version 450 core
+
+// Input
+in vec2 texCords;
+
+// Uniform Variables
+uniform sampler2D inputTexture;
+uniform sampler2D weightsTexture;
+
+// Output
+out vec4 fragColor;
+
+// Texel of A Pixel - Pixels Past The Border Repeat The Border
+vec4 fetchClamped(sampler2D tex, ivec2 pixel) {
+    return texelFetch(tex, clamp(pixel, ivec2(0), textureSize(tex, 0) - 1), 0);
+}
+
+// Main - Blend With The Neighbors Across This Pixel's Edges by How Much of It Their Side Covers
+void main(void) {
+    ivec2 pixel = ivec2(gl_FragCoord.xy);
+    vec4 weights = fetchClamped(weightsTexture, pixel);
+    float towardBottom = weights.x, towardLeft = weights.z;
+    float towardTop = fetchClamped(weightsTexture, pixel + ivec2(0, 1)).y;
+    float towardRight = fetchClamped(weightsTexture, pixel + ivec2(1, 0)).w;
+
+    // Most Pixels Aren't on An Edge
+    vec4 color = fetchClamped(inputTexture, pixel);
+    if(towardBottom + towardTop + towardLeft + towardRight < 0.00001f) {
+        fragColor = vec4(color.rgb, 1.0f);
+        return;
+    }
+
+    // Blend Along The Axis With The Larger Weights Only - Blending Both Would Smear Corners
+    if(max(towardLeft, towardRight) > max(towardBottom, towardTop)) {
+        color = color * (1.0f - towardLeft - towardRight) + fetchClamped(inputTexture, pixel + ivec2(-1, 0)) * towardLeft + fetchClamped(inputTexture, pixel + ivec2(1, 0)) * towardRight;
+    } else {
+        color = color * (1.0f - towardBottom - towardTop) + fetchClamped(inputTexture, pixel + ivec2(0, -1)) * towardBottom + fetchClamped(inputTexture, pixel + ivec2(0, 1)) * towardTop;
+    }
+    fragColor = vec4(color.rgb, 1.0f);
+}
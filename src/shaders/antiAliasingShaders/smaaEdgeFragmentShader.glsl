@@ -0,0 +1,42 @@
+#version 450 core
+
+// Input
+in vec2 texCords;
+
+// Uniform Variables - Smallest Luma Difference That Counts as An Edge
+uniform sampler2D inputTexture;
+uniform float threshold;
+
+// Output - Whether The Pixel Has An Edge on Its Left (r) and Bottom (g) Side
+out vec2 fragColor;
+
+// An Edge Only Counts if It's At Least This Fraction of The Strongest Edge Next to It - Keeps Only The Dominant Edges of Busy Areas
+#define LOCAL_CONTRAST_FACTOR 2.0f
+
+// Luma of A Pixel - Pixels Past The Border Repeat The Border, So The Border Has No Edges
+float lumaAt(ivec2 pixel) {
+    pixel = clamp(pixel, ivec2(0), textureSize(inputTexture, 0) - 1);
+    return dot(texelFetch(inputTexture, pixel, 0).rgb, vec3(0.2126f, 0.7152f, 0.0722f));
+}
+
+// Main
+void main(void) {
+    ivec2 pixel = ivec2(gl_FragCoord.xy);
+    float luma = lumaAt(pixel);
+    float lumaLeft = lumaAt(pixel + ivec2(-1, 0));
+    float lumaBottom = lumaAt(pixel + ivec2(0, -1));
+    vec2 delta = abs(luma - vec2(lumaLeft, lumaBottom));
+    vec2 edges = step(threshold, delta);
+    if(edges == vec2(0.0f)) {
+        fragColor = vec2(0.0f);
+        return;
+    }
+
+    // Local Contrast Adaptation - Compare With The Differences Across The Neighbors' Sides
+    float maxDelta = max(delta.x, delta.y);
+    maxDelta = max(maxDelta, abs(luma - lumaAt(pixel + ivec2(1, 0))));
+    maxDelta = max(maxDelta, abs(luma - lumaAt(pixel + ivec2(0, 1))));
+    maxDelta = max(maxDelta, abs(lumaLeft - lumaAt(pixel + ivec2(-2, 0))));
+    maxDelta = max(maxDelta, abs(lumaBottom - lumaAt(pixel + ivec2(0, -2))));
+    fragColor = edges * step(maxDelta, LOCAL_CONTRAST_FACTOR * delta);
+}
@@ -0,0 +1,84 @@
+#version 450 core
+
+// Input
+in vec2 texCords;
+
+// Uniform Variables - Pixels Searched Along An Edge in Each Direction
+uniform sampler2D edgesTexture;
+uniform int maxSearchSteps;
+
+// Output - Fractions of The Pixel Across The Bottom Edge This Pixel Takes (x) and Gives It (y), Likewise For The Left Edge (z, w)
+out vec4 fragColor;
+
+// Edges of A Pixel - None Past The Border
+vec2 edgesAt(ivec2 pixel) {
+    if(any(lessThan(pixel, ivec2(0))) || any(greaterThanEqual(pixel, textureSize(edgesTexture, 0)))) return vec2(0.0f);
+    return texelFetch(edgesTexture, pixel, 0).rg;
+}
+
+// Height of The Reconstructed Shape's Outline Over The Edge at A Distance Along It
+// An End With A Crossing Edge Lifts The Outline to Half A Pixel Toward The Crossing's Side, With Crossings at Both Ends It Returns to The Edge Halfway
+float outlineHeight(float x, float start, float end, float startHeight, float endHeight) {
+    if(startHeight != 0.0f && endHeight != 0.0f) {
+        float center = 0.5f * (start + end);
+        return x < center ? startHeight * (center - x) / (center - start) : endHeight * (x - center) / (end - center);
+    }
+    if(startHeight != 0.0f) return startHeight * (end - x) / (end - start);
+    return endHeight * (x - start) / (end - start);
+}
+
+// Areas Above (x) and Below (y) The Edge Under A Straight Piece of The Outline
+vec2 segmentArea(float height0, float height1, float width) {
+    if(height0 * height1 >= 0.0f) {
+        float area = 0.5f * (height0 + height1) * width;
+        return vec2(max(area, 0.0f), max(-area, 0.0f));
+    }
+    float crossing = height0 / (height0 - height1) * width;
+    float area0 = 0.5f * height0 * crossing, area1 = 0.5f * height1 * (width - crossing);
+    return vec2(max(area0, 0.0f) + max(area1, 0.0f), max(-area0, 0.0f) + max(-area1, 0.0f));
+}
+
+// Areas on Either Side of The Edge Covered by The Other Side's Shape Within The Pixel From 0 to 1 Along The Edge
+vec2 edgeArea(float start, float end, float startHeight, float endHeight) {
+    if(startHeight == 0.0f && endHeight == 0.0f) return vec2(0.0f);
+    float height0 = outlineHeight(0.0f, start, end, startHeight, endHeight);
+    float height1 = outlineHeight(1.0f, start, end, startHeight, endHeight);
+    float center = 0.5f * (start + end);
+    if(startHeight != 0.0f && endHeight != 0.0f && center > 0.0f && center < 1.0f) {
+        return segmentArea(height0, 0.0f, center) + segmentArea(0.0f, height1, 1.0f - center);
+    }
+    return segmentArea(height0, height1, 1.0f);
+}
+
+// Outline Height at An End From Its Crossing Edges - Ambiguous When Both Sides Cross
+float crossingHeight(float towardPixel, float awayFromPixel) {
+    return towardPixel > 0.5f && awayFromPixel < 0.5f ? 0.5f : (awayFromPixel > 0.5f && towardPixel < 0.5f ? -0.5f : 0.0f);
+}
+
+// Main - Search Each Edge's Run Both Ways, Then Read The Crossing Edges at Its Ends
+void main(void) {
+    ivec2 pixel = ivec2(gl_FragCoord.xy);
+    vec2 edges = edgesAt(pixel);
+    vec4 weights = vec4(0.0f);
+
+    // Bottom Edge - The Run Goes Left and Right, Crossings Are Left Edges Above (Toward This Pixel) or Below It
+    if(edges.g > 0.5f) {
+        int left = 0, right = 0;
+        while(left < maxSearchSteps && edgesAt(pixel - ivec2(left + 1, 0)).g > 0.5f) left++;
+        while(right < maxSearchSteps && edgesAt(pixel + ivec2(right + 1, 0)).g > 0.5f) right++;
+        float startHeight = left < maxSearchSteps ? crossingHeight(edgesAt(pixel - ivec2(left, 0)).r, edgesAt(pixel - ivec2(left, 1)).r) : 0.0f;
+        float endHeight = right < maxSearchSteps ? crossingHeight(edgesAt(pixel + ivec2(right + 1, 0)).r, edgesAt(pixel + ivec2(right + 1, -1)).r) : 0.0f;
+        weights.xy = edgeArea(-float(left), float(right + 1), startHeight, endHeight);
+    }
+
+    // Left Edge - The Run Goes Down and Up, Crossings Are Bottom Edges Right (Toward This Pixel) or Left of It
+    if(edges.r > 0.5f) {
+        int down = 0, up = 0;
+        while(down < maxSearchSteps && edgesAt(pixel - ivec2(0, down + 1)).r > 0.5f) down++;
+        while(up < maxSearchSteps && edgesAt(pixel + ivec2(0, up + 1)).r > 0.5f) up++;
+        float startHeight = down < maxSearchSteps ? crossingHeight(edgesAt(pixel - ivec2(0, down)).g, edgesAt(pixel - ivec2(1, down)).g) : 0.0f;
+        float endHeight = up < maxSearchSteps ? crossingHeight(edgesAt(pixel + ivec2(0, up + 1)).g, edgesAt(pixel + ivec2(-1, up + 1)).g) : 0.0f;
+        weights.zw = edgeArea(-float(down), float(up + 1), startHeight, endHeight);
+    }
+    fragColor = weights;
+}
@@ -0,0 +1,54 @@
+#version 450 core
+
+// Input
+in vec2 texCords;
+
+// Uniform Variables - The Blend Factor is The Current Frame's Share of The Result
+uniform sampler2D inputTexture;
+uniform sampler2D velocityTexture;
+uniform sampler2D historyTexture;
+uniform bool historyValid;
+uniform float blendFactor;
+
+// Output
+out vec4 fragColor;
+
+// YCoCg - Luma and Chroma Are Separate Axes, So The Neighborhood Box Fits The Colors More Tightly Than in RGB
+vec3 toYCoCg(vec3 color) {
+    return vec3(dot(color, vec3(0.25f, 0.5f, 0.25f)), dot(color, vec3(0.5f, 0.0f, -0.5f)), dot(color, vec3(-0.25f, 0.5f, -0.25f)));
+}
+vec3 fromYCoCg(vec3 color) {
+    return vec3(color.x + color.y - color.z, color.x + color.z, color.x - color.y - color.z);
+}
+
+// Main - Reproject The History, Clamp It to The Current 3x3 Neighborhood's Color Range and Blend The Current Frame In
+void main(void) {
+    ivec2 pixel = ivec2(gl_FragCoord.xy);
+    ivec2 size = textureSize(inputTexture, 0);
+    vec3 current = texelFetch(inputTexture, pixel, 0).rgb;
+
+    // Nothing to Reproject From - First Frame at This Size or The Surface Was Off Screen
+    vec2 historyUV = texCords - texelFetch(velocityTexture, pixel, 0).rg;
+    if(!historyValid || any(lessThan(historyUV, vec2(0.0f))) || any(greaterThan(historyUV, vec2(1.0f)))) {
+        fragColor = vec4(current, 1.0f);
+        return;
+    }
+
+    // Neighborhood Color Range - History Outside It Belongs to Something No Longer There (Disocclusion, Lighting Change)
+    vec3 minColor = vec3(1.0e9f), maxColor = vec3(-1.0e9f);
+    for(int y = -1; y <= 1; y++) {
+        for(int x = -1; x <= 1; x++) {
+            vec3 neighbor = toYCoCg(texelFetch(inputTexture, clamp(pixel + ivec2(x, y), ivec2(0), size - 1), 0).rgb);
+            minColor = min(minColor, neighbor);
+            maxColor = max(maxColor, neighbor);
+        }
+    }
+    vec3 history = clamp(toYCoCg(textureLod(historyTexture, historyUV, 0.0f).rgb), minColor, maxColor);
+
+    // Blend Weighted by Inverse Luma - Keeps Single Bright Samples From Flickering
+    vec3 currentColor = toYCoCg(current);
+    float currentWeight = blendFactor / (1.0f + currentColor.x);
+    float historyWeight = (1.0f - blendFactor) / (1.0f + history.x);
+    vec3 result = (currentColor * currentWeight + history * historyWeight) / (currentWeight + historyWeight);
+    fragColor = vec4(max(fromYCoCg(result), vec3(0.0f)), 1.0f);
+}
@@ -0,0 +1,13 @@
+#version 450 core
+
+// Output
+out vec2 texCords;
+
+// Main - Full Screen Triangle From The Vertex Index, No Vertex Buffers Needed
+void main(void) {
+    // Texture Coordinates (0, 0), (2, 0) and (0, 2) - The Triangle Covers The Whole Screen
+    texCords = vec2((gl_VertexID << 1) & 2, gl_VertexID & 2);
+
+    // Calculate and Set Final Vertex Position
+    gl_Position = vec4(texCords * 2.0f - 1.0f, 0.0f, 1.0f);
+}
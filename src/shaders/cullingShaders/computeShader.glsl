@@ -0,0 +1,103 @@
+#version 450 core
+
+// GLSL 4.50 So GPU Culling Also Runs on Mesa llvmpipe
+layout(local_size_x = 64) in;
+
+// Draw Elements Indirect Command
+struct DrawCommand {
+    uint count, instanceCount, firstIndex;
+    int baseVertex;
+    uint baseInstance;
+};
+
+// Buffers
+layout(std430, binding = 0) readonly buffer InstanceBuffer {
+    mat4 instanceMatrices[];
+};
+layout(std430, binding = 1) writeonly buffer CommandBuffer {
+    DrawCommand commands[];
+};
+layout(std430, binding = 2) buffer DrawCountBuffer {
+    uint drawCount;
+};
+layout(std430, binding = 3) buffer VisibilityBuffer {
+    uint instanceVisibility[];
+};
+
+// Hierarchical-Z Pyramid - Farthest Depth Per Texel
+layout(binding = 0) uniform sampler2D hiZPyramid;
+
+// Uniform Variables
+uniform vec4 frustumPlanes[6];
+uniform vec4 boundingSphere;
+uniform int instanceCount, indexCount;
+uniform bool compactCommands;
+
+// Occlusion Uniform Variables - Phase 0 Frustum Only, Phase 1 Last Frame Visible, Phase 2 Hi-Z Retest
+uniform int cullPhase;
+uniform mat4 projectionViewMatrix;
+uniform vec2 hiZSize;
+uniform int hiZMipCount;
+
+// Test A World Space Sphere Against The Hi-Z Pyramid - True Only if Fully Behind The Depth Already Drawn
+bool occluded(vec3 center, float radius) {
+    // Screen Space Bounds of The Sphere's Bounding Box - Anything Crossing The Near Plane is Treated as Visible
+    vec2 minUV = vec2(1.0f), maxUV = vec2(0.0f);
+    float nearestDepth = 1.0f;
+    for(int i = 0; i < 8; i++) {
+        vec3 corner = center + radius * vec3((i & 1) != 0 ? 1.0f : -1.0f, (i & 2) != 0 ? 1.0f : -1.0f, (i & 4) != 0 ? 1.0f : -1.0f);
+        vec4 clipPosition = projectionViewMatrix * vec4(corner, 1.0f);
+        if(clipPosition.w <= 0.0f) return false;
+        vec3 ndcPosition = clipPosition.xyz / clipPosition.w;
+        minUV = min(minUV, ndcPosition.xy * 0.5f + 0.5f);
+        maxUV = max(maxUV, ndcPosition.xy * 0.5f + 0.5f);
+        nearestDepth = min(nearestDepth, ndcPosition.z * 0.5f + 0.5f);
+    }
+    minUV = clamp(minUV, vec2(0.0f), vec2(1.0f));
+    maxUV = clamp(maxUV, vec2(0.0f), vec2(1.0f));
+
+    // Pick The Level Where The Bounds Cover At Most 2x2 Texels and Take The Farthest of Them
+    vec2 pixelExtent = (maxUV - minUV) * hiZSize;
+    float level = clamp(ceil(log2(max(max(pixelExtent.x, pixelExtent.y), 1.0f))), 0.0f, float(hiZMipCount - 1));
+    float farthestDepth = max(max(textureLod(hiZPyramid, minUV, level).r, textureLod(hiZPyramid, vec2(maxUV.x, minUV.y), level).r),
+                              max(textureLod(hiZPyramid, vec2(minUV.x, maxUV.y), level).r, textureLod(hiZPyramid, maxUV, level).r));
+    return nearestDepth > farthestDepth;
+}
+
+// Main
+void main(void) {
+    uint instance = gl_GlobalInvocationID.x;
+    if(instance >= uint(instanceCount)) return;
+
+    // Instance Bounding Sphere in World Space - Radius Scaled by The Largest Axis Scale
+    mat4 modelMatrix = instanceMatrices[instance];
+    vec3 center = (modelMatrix * vec4(boundingSphere.xyz, 1.0f)).xyz;
+    float scale = max(length(modelMatrix[0].xyz), max(length(modelMatrix[1].xyz), length(modelMatrix[2].xyz)));
+    float radius = boundingSphere.w * scale;
+
+    // Test Bounding Sphere Against All Frustum Planes
+    bool visible = true;
+    for(int i = 0; i < 6; i++) {
+        if(dot(frustumPlanes[i].xyz, center) + frustumPlanes[i].w < -radius) visible = false;
+    }
+
+    // Two-Phase Occlusion - Phase 1 Redraws Last Frame's Visible Set, Phase 2 Retests Against This Frame's Pyramid
+    // and Only Draws Instances Phase 1 Skipped, Recording Visibility For The Next Frame
+    if(cullPhase == 1) {
+        visible = visible && instanceVisibility[instance] != 0u;
+    } else if(cullPhase == 2) {
+        bool visibleNow = visible && !occluded(center, radius);
+        visible = visibleNow && instanceVisibility[instance] == 0u;
+        instanceVisibility[instance] = visibleNow ? 1u : 0u;
+    }
+
+    // Write Draw Command - Compacted When The Draw Count is Consumed by glMultiDrawElementsIndirectCount
+    DrawCommand command = DrawCommand(uint(indexCount), 1u, 0u, 0, instance);
+    if(compactCommands) {
+        if(visible) commands[atomicAdd(drawCount, 1u)] = command;
+    } else {
+        command.instanceCount = visible ? 1u : 0u;
+        commands[instance] = command;
+        if(visible) atomicAdd(drawCount, 1u);
+    }
+}
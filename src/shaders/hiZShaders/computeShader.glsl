@@ -0,0 +1,36 @@
+#version 450 core
+
+// One Invocation Per Destination Texel
+layout(local_size_x = 8, local_size_y = 8) in;
+
+// Source Depth Texture (Level 0) or Previous Pyramid Level and Destination Pyramid Level
+layout(binding = 0) uniform sampler2D depthTexture;
+layout(binding = 0, r32f) readonly uniform image2D sourceLevel;
+layout(binding = 1, r32f) writeonly uniform image2D destinationLevel;
+
+// Uniform Variables
+uniform bool copyDepth;
+uniform ivec2 sourceSize, destinationSize;
+
+// Main
+void main(void) {
+    ivec2 texel = ivec2(gl_GlobalInvocationID.xy);
+    if(any(greaterThanEqual(texel, destinationSize))) return;
+
+    // Level 0 is A Straight Copy of The Depth Buffer
+    if(copyDepth) {
+        imageStore(destinationLevel, texel, vec4(texelFetch(depthTexture, texel, 0).r));
+        return;
+    }
+
+    // Farthest Depth of The Source Footprint - Odd Source Sizes Fold The Extra Row/Column Into The Last Texel
+    ivec2 first = texel * 2;
+    ivec2 last = min(first + ivec2(1) + ivec2(equal(texel, destinationSize - 1)) * (sourceSize & 1), sourceSize - 1);
+    float depth = 0.0f;
+    for(int y = first.y; y <= last.y; y++) {
+        for(int x = first.x; x <= last.x; x++) {
+            depth = max(depth, imageLoad(sourceLevel, ivec2(x, y)).r);
+        }
+    }
+    imageStore(destinationLevel, texel, vec4(depth));
+}
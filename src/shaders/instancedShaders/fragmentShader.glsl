@@ -0,0 +1,19 @@
+#version 450 core
+
+// Input
+in vec3 normalVec;
+in vec2 texCords;
+
+// Uniform Variables
+uniform vec3 lightDirection;
+uniform vec3 baseColor;
+
+// Output
+out vec4 fragColor;
+
+// Main
+void main(void) {
+    // Calculate and Set Final Fragment Color - Simple Directional Diffuse Lighting
+    float diffuse = max(dot(normalize(normalVec), -normalize(lightDirection)), 0.0f);
+    fragColor = vec4(baseColor * (0.2f + 0.8f * diffuse), 1.0f);
+}
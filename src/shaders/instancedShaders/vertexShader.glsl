@@ -0,0 +1,43 @@
+#version 450 core
+
+// Vertex Attributes
+layout(location = 0) in vec3 vertexPosition;
+layout(location = 1) in vec3 normalVector;
+layout(location = 2) in vec2 textureCoords;
+layout(location = 3) in uint instanceIndex;
+
+// Instance Model Matrices
+layout(std430, binding = 0) readonly buffer InstanceBuffer {
+    mat4 instanceMatrices[];
+};
+
+// Uniform Variables
+uniform mat4 pv;
+
+// Vertex Decoding - Identity For Float32 Meshes
+uniform vec3 dequantOffset, dequantScale;
+uniform bool octahedralNormals;
+
+// Output
+out vec3 normalVec;
+out vec2 texCords;
+
+// Decode Octahedral Encoded Normal Vector
+vec3 octahedralDecode(vec2 encoded) {
+    vec3 normalVector = vec3(encoded, 1.0f - abs(encoded.x) - abs(encoded.y));
+    float t = max(-normalVector.z, 0.0f);
+    normalVector.xy += vec2(normalVector.x >= 0.0f ? -t : t, normalVector.y >= 0.0f ? -t : t);
+    return normalize(normalVector);
+}
+
+// Main
+void main(void) {
+    // Calculate and Set Final Vertex Position
+    mat4 modelMatrix = instanceMatrices[instanceIndex];
+    gl_Position = pv * modelMatrix * vec4(dequantOffset + vertexPosition * dequantScale, 1.0f);
+
+    // Send World Space Normal Vector and Texture Coordinates to Fragment Shader
+    vec3 normalVector = octahedralNormals ? octahedralDecode(normalVector.xy) : normalVector;
+    normalVec = mat3(modelMatrix) * normalVector;
+    texCords = textureCoords;
+}
@@ -0,0 +1,13 @@
+#version 450 core
+
+// Input
+in vec4 color;
+
+// Output
+out vec4 fragColor;
+
+// Main
+void main(void) {
+    // Set Final Fragment Color
+    fragColor = color;
+}
@@ -0,0 +1,23 @@
+#version 450 core
+
+// Vertex Attributes - Font Space Position in Pixels, Y Pointing Down
+layout(location = 0) in vec2 vertexPosition;
+layout(location = 1) in vec4 vertexColor;
+
+// Uniform Variables
+uniform vec2 origin;
+uniform float scale;
+uniform vec2 viewportSize;
+
+// Output
+out vec4 color;
+
+// Main
+void main(void) {
+    // Scale and Place in Pixels From The Top Left, Then Map to Clip Space
+    vec2 pixelPosition = origin + vertexPosition * scale;
+    gl_Position = vec4(pixelPosition / viewportSize * vec2(2.0f, -2.0f) + vec2(-1.0f, 1.0f), 0.0f, 1.0f);
+
+    // Send Color to Fragment Shader
+    color = vertexColor;
+}
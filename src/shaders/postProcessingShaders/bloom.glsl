@@ -0,0 +1,7 @@
+// Bloom - Adds The Upsampled Bloom Chain
+uniform sampler2D bloomTexture;
+uniform float bloomIntensity;
+
+vec3 applyBloom(vec3 color, vec2 uv) {
+    return color + texture(bloomTexture, uv).rgb * bloomIntensity;
+}
@@ -0,0 +1,32 @@
+#version 450 core
+
+// Work Group Size
+layout(local_size_x = 8, local_size_y = 8, local_size_z = 1) in;
+
+// Uniform Variables - The First Level Keeps Only The Part of Each Color Above The Threshold
+uniform sampler2D inputTexture;
+writeonly uniform image2D outputImage;
+uniform bool prefilter;
+uniform float threshold;
+uniform float knee;
+
+// Soft Threshold - Quadratic Ramp Over The Knee So Bloom Fades In Instead of Popping
+vec3 prefilterColor(vec3 color) {
+    float brightness = max(color.r, max(color.g, color.b));
+    float soft = clamp(brightness - threshold + knee, 0.0f, 2.0f * knee);
+    soft = soft * soft / (4.0f * knee + 0.00001f);
+    return color * max(soft, brightness - threshold) / max(brightness, 0.00001f);
+}
+
+// Main - Four Bilinear Taps Average A 4x4 Texel Box
+void main(void) {
+    ivec2 pixel = ivec2(gl_GlobalInvocationID.xy);
+    ivec2 outputSize = imageSize(outputImage);
+    if(any(greaterThanEqual(pixel, outputSize))) return;
+
+    vec2 uv = (vec2(pixel) + 0.5f) / vec2(outputSize);
+    vec2 texelSize = 1.0f / vec2(textureSize(inputTexture, 0));
+    vec3 color = 0.25f * (textureLod(inputTexture, uv + texelSize * vec2(-1.0f, -1.0f), 0.0f).rgb + textureLod(inputTexture, uv + texelSize * vec2(1.0f, -1.0f), 0.0f).rgb
+                       + textureLod(inputTexture, uv + texelSize * vec2(-1.0f, 1.0f), 0.0f).rgb + textureLod(inputTexture, uv + texelSize * vec2(1.0f, 1.0f), 0.0f).rgb);
+    imageStore(outputImage, pixel, vec4(prefilter ? prefilterColor(color) : color, 1.0f));
+}
@@ -0,0 +1,29 @@
+#version 450 core
+
+// Input
+in vec2 texCords;
+
+// Uniform Variables - The First Level Keeps Only The Part of Each Color Above The Threshold
+uniform sampler2D inputTexture;
+uniform bool prefilter;
+uniform float threshold;
+uniform float knee;
+
+// Output
+out vec4 fragColor;
+
+// Soft Threshold - Quadratic Ramp Over The Knee So Bloom Fades In Instead of Popping
+vec3 prefilterColor(vec3 color) {
+    float brightness = max(color.r, max(color.g, color.b));
+    float soft = clamp(brightness - threshold + knee, 0.0f, 2.0f * knee);
+    soft = soft * soft / (4.0f * knee + 0.00001f);
+    return color * max(soft, brightness - threshold) / max(brightness, 0.00001f);
+}
+
+// Main - Four Bilinear Taps Average A 4x4 Texel Box
+void main(void) {
+    vec2 texelSize = 1.0f / vec2(textureSize(inputTexture, 0));
+    vec3 color = 0.25f * (texture(inputTexture, texCords + texelSize * vec2(-1.0f, -1.0f)).rgb + texture(inputTexture, texCords + texelSize * vec2(1.0f, -1.0f)).rgb
+                       + texture(inputTexture, texCords + texelSize * vec2(-1.0f, 1.0f)).rgb + texture(inputTexture, texCords + texelSize * vec2(1.0f, 1.0f)).rgb);
+    fragColor = vec4(prefilter ? prefilterColor(color) : color, 1.0f);
+}
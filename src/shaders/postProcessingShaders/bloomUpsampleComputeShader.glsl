@@ -0,0 +1,25 @@
+#version 450 core
+
+// Work Group Size
+layout(local_size_x = 8, local_size_y = 8, local_size_z = 1) in;
+
+// Uniform Variables - This Level and The Accumulated Levels Below It
+uniform sampler2D inputTexture;
+uniform sampler2D lowerTexture;
+writeonly uniform image2D outputImage;
+
+// Main - 3x3 Tent Filter Over The Lower Level
+void main(void) {
+    ivec2 pixel = ivec2(gl_GlobalInvocationID.xy);
+    ivec2 outputSize = imageSize(outputImage);
+    if(any(greaterThanEqual(pixel, outputSize))) return;
+
+    vec2 uv = (vec2(pixel) + 0.5f) / vec2(outputSize);
+    vec2 texelSize = 1.0f / vec2(textureSize(lowerTexture, 0));
+    vec3 lower = 4.0f * textureLod(lowerTexture, uv, 0.0f).rgb;
+    lower += 2.0f * (textureLod(lowerTexture, uv + vec2(texelSize.x, 0.0f), 0.0f).rgb + textureLod(lowerTexture, uv - vec2(texelSize.x, 0.0f), 0.0f).rgb
+                   + textureLod(lowerTexture, uv + vec2(0.0f, texelSize.y), 0.0f).rgb + textureLod(lowerTexture, uv - vec2(0.0f, texelSize.y), 0.0f).rgb);
+    lower += textureLod(lowerTexture, uv + texelSize, 0.0f).rgb + textureLod(lowerTexture, uv - texelSize, 0.0f).rgb
+           + textureLod(lowerTexture, uv + vec2(texelSize.x, -texelSize.y), 0.0f).rgb + textureLod(lowerTexture, uv + vec2(-texelSize.x, texelSize.y), 0.0f).rgb;
+    imageStore(outputImage, pixel, vec4(texelFetch(inputTexture, pixel, 0).rgb + lower / 16.0f, 1.0f));
+}
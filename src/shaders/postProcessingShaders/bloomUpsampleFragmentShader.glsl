@@ -0,0 +1,22 @@
+#version 450 core
+
+// Input
+in vec2 texCords;
+
+// Uniform Variables - This Level and The Accumulated Levels Below It
+uniform sampler2D inputTexture;
+uniform sampler2D lowerTexture;
+
+// Output
+out vec4 fragColor;
+
+// Main - 3x3 Tent Filter Over The Lower Level
+void main(void) {
+    vec2 texelSize = 1.0f / vec2(textureSize(lowerTexture, 0));
+    vec3 lower = 4.0f * texture(lowerTexture, texCords).rgb;
+    lower += 2.0f * (texture(lowerTexture, texCords + vec2(texelSize.x, 0.0f)).rgb + texture(lowerTexture, texCords - vec2(texelSize.x, 0.0f)).rgb
+                   + texture(lowerTexture, texCords + vec2(0.0f, texelSize.y)).rgb + texture(lowerTexture, texCords - vec2(0.0f, texelSize.y)).rgb);
+    lower += texture(lowerTexture, texCords + texelSize).rgb + texture(lowerTexture, texCords - texelSize).rgb
+           + texture(lowerTexture, texCords + vec2(texelSize.x, -texelSize.y)).rgb + texture(lowerTexture, texCords + vec2(-texelSize.x, texelSize.y)).rgb;
+    fragColor = vec4(texture(inputTexture, texCords).rgb + lower / 16.0f, 1.0f);
+}
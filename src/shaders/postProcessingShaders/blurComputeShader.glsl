@@ -0,0 +1,45 @@
+#version 450 core
+
+// Pixels Per Workgroup Along The Blur Axis and The Largest Radius
+#define TILE_SIZE 128
+#define MAX_RADIUS 32
+
+// Work Group Size - One Workgroup Per TILE_SIZE Pixels of A Row (Horizontal) or Column (Vertical)
+layout(local_size_x = TILE_SIZE, local_size_y = 1, local_size_z = 1) in;
+
+// Uniform Variables - Weights of The Center and Each Distance Along The Blur Direction
+uniform sampler2D inputTexture;
+writeonly uniform image2D outputImage;
+uniform ivec2 direction;
+uniform int radius;
+uniform float weights[MAX_RADIUS + 1];
+
+// The Workgroup's Pixels Plus radius Texels of Apron on Each Side
+shared vec4 tile[TILE_SIZE + 2 * MAX_RADIUS];
+
+// Main - Each Texel is Fetched Once Into Shared Memory and Read From There by Every Tap Covering It
+void main(void) {
+    ivec2 size = textureSize(inputTexture, 0);
+    bool horizontal = direction.x != 0;
+    int lineLength = horizontal ? size.x : size.y;
+    int line = int(gl_WorkGroupID.y);
+    int lineStart = int(gl_WorkGroupID.x) * TILE_SIZE;
+
+    // Load The Tile and Its Apron - Edges Are Clamped
+    for(int i = int(gl_LocalInvocationID.x); i < TILE_SIZE + 2 * radius; i += TILE_SIZE) {
+        int along = clamp(lineStart + i - radius, 0, lineLength - 1);
+        tile[i] = texelFetch(inputTexture, horizontal ? ivec2(along, line) : ivec2(line, along), 0);
+    }
+    memoryBarrierShared();
+    barrier();
+
+    // Convolve From Shared Memory
+    int along = lineStart + int(gl_LocalInvocationID.x);
+    if(along >= lineLength) return;
+    int center = int(gl_LocalInvocationID.x) + radius;
+    vec4 sum = tile[center] * weights[0];
+    for(int i = 1; i <= radius; i++) {
+        sum += (tile[center - i] + tile[center + i]) * weights[i];
+    }
+    imageStore(outputImage, horizontal ? ivec2(along, line) : ivec2(line, along), sum);
+}
@@ -0,0 +1,23 @@
+#version 450 core
+
+// Input
+in vec2 texCords;
+
+// Uniform Variables - Weights of The Center and Each Distance Along The Blur Direction
+uniform sampler2D inputTexture;
+uniform ivec2 direction;
+uniform int radius;
+uniform float weights[33];
+
+// Output
+out vec4 fragColor;
+
+// Main - One Fetch Per Tap
+void main(void) {
+    vec2 texelStep = vec2(direction) / vec2(textureSize(inputTexture, 0));
+    vec4 sum = texture(inputTexture, texCords) * weights[0];
+    for(int i = 1; i <= radius; i++) {
+        sum += (texture(inputTexture, texCords + texelStep * i) + texture(inputTexture, texCords - texelStep * i)) * weights[i];
+    }
+    fragColor = sum;
+}
@@ -0,0 +1,9 @@
+// Color Grade - Looks The Color Up in A 3D LUT, Sampled at Texel Centers So The Edges of The LUT Aren't Blended With The Border
+uniform sampler3D colorGradeLUT;
+uniform float colorGradeStrength;
+
+vec3 applyColorGrade(vec3 color) {
+    float lutSize = float(textureSize(colorGradeLUT, 0).x);
+    vec3 graded = texture(colorGradeLUT, clamp(color, 0.0f, 1.0f) * ((lutSize - 1.0f) / lutSize) + 0.5f / lutSize).rgb;
+    return mix(color, graded, colorGradeStrength);
+}
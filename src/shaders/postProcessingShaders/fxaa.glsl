@@ -0,0 +1,37 @@
+// FXAA - Blurs Along Edges Found From Luma Contrast, Skipping Pixels Whose Neighborhood Has Too Little Contrast
+uniform float fxaaSpanMax;
+uniform float fxaaEdgeThreshold;
+uniform float fxaaEdgeThresholdMin;
+
+float fxaaLuma(vec3 color) {
+    return dot(color, vec3(0.299f, 0.587f, 0.114f));
+}
+
+vec4 applyFXAA(sampler2D tex, vec2 uv) {
+    vec2 texelSize = 1.0f / vec2(textureSize(tex, 0));
+
+    // Center and Diagonal Neighbors
+    vec3 colorM = textureLod(tex, uv, 0.0f).rgb;
+    float lumaM = fxaaLuma(colorM);
+    float lumaNW = fxaaLuma(textureLod(tex, uv + vec2(-1.0f, -1.0f) * texelSize, 0.0f).rgb);
+    float lumaNE = fxaaLuma(textureLod(tex, uv + vec2(1.0f, -1.0f) * texelSize, 0.0f).rgb);
+    float lumaSW = fxaaLuma(textureLod(tex, uv + vec2(-1.0f, 1.0f) * texelSize, 0.0f).rgb);
+    float lumaSE = fxaaLuma(textureLod(tex, uv + vec2(1.0f, 1.0f) * texelSize, 0.0f).rgb);
+
+    // Early Out on Low Contrast
+    float lumaMin = min(lumaM, min(min(lumaNW, lumaNE), min(lumaSW, lumaSE)));
+    float lumaMax = max(lumaM, max(max(lumaNW, lumaNE), max(lumaSW, lumaSE)));
+    if(lumaMax - lumaMin < max(fxaaEdgeThresholdMin, lumaMax * fxaaEdgeThreshold)) return vec4(colorM, 1.0f);
+
+    // Blur Direction Along The Edge - Shorter Axis Scaled to One Texel
+    vec2 direction = vec2(-((lumaNW + lumaNE) - (lumaSW + lumaSE)), (lumaNW + lumaSW) - (lumaNE + lumaSE));
+    float directionReduce = max((lumaNW + lumaNE + lumaSW + lumaSE) * 0.03125f, 1.0f / 128.0f);
+    float inverseDirectionMin = 1.0f / (min(abs(direction.x), abs(direction.y)) + directionReduce);
+    direction = clamp(direction * inverseDirectionMin, -fxaaSpanMax, fxaaSpanMax) * texelSize;
+
+    // Two Tap and Four Tap Blurs - The Wider One Unless It Reached Past The Edge
+    vec3 colorA = 0.5f * (textureLod(tex, uv + direction * (1.0f / 3.0f - 0.5f), 0.0f).rgb + textureLod(tex, uv + direction * (2.0f / 3.0f - 0.5f), 0.0f).rgb);
+    vec3 colorB = colorA * 0.5f + 0.25f * (textureLod(tex, uv - direction * 0.5f, 0.0f).rgb + textureLod(tex, uv + direction * 0.5f, 0.0f).rgb);
+    float lumaB = fxaaLuma(colorB);
+    return vec4(lumaB < lumaMin || lumaB > lumaMax ? colorA : colorB, 1.0f);
+}
@@ -0,0 +1,16 @@
+// Sharpen - Unsharp Mask Over The Four Direct Neighbors, Clamped to Their Range So Edges Don't Get Halos
+uniform float sharpenStrength;
+
+vec4 applySharpen(sampler2D tex, vec2 uv) {
+    vec2 texelSize = 1.0f / vec2(textureSize(tex, 0));
+    vec3 center = textureLod(tex, uv, 0.0f).rgb;
+    vec3 north = textureLod(tex, uv + vec2(0.0f, texelSize.y), 0.0f).rgb;
+    vec3 south = textureLod(tex, uv - vec2(0.0f, texelSize.y), 0.0f).rgb;
+    vec3 east = textureLod(tex, uv + vec2(texelSize.x, 0.0f), 0.0f).rgb;
+    vec3 west = textureLod(tex, uv - vec2(texelSize.x, 0.0f), 0.0f).rgb;
+
+    vec3 minimum = min(center, min(min(north, south), min(east, west)));
+    vec3 maximum = max(center, max(max(north, south), max(east, west)));
+    vec3 sharpened = center + (4.0f * center - north - south - east - west) * sharpenStrength;
+    return vec4(clamp(sharpened, minimum, maximum), 1.0f);
+}
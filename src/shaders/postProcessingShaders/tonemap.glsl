@@ -0,0 +1,7 @@
+// Tonemap - Fitted ACES Filmic Curve Applied After Exposure
+uniform float exposure;
+
+vec3 applyTonemap(vec3 color) {
+    color *= exposure;
+    return clamp((color * (2.51f * color + 0.03f)) / (color * (2.43f * color + 0.59f) + 0.14f), 0.0f, 1.0f);
+}
@@ -0,0 +1,34 @@
+// Upscale - Catmull-Rom Filtered Sample, Nine Bilinear Taps in Place of Sixteen Point Taps, Sharper Than Bilinear When Upscaling
+vec4 sampleCatmullRom(sampler2D tex, vec2 uv) {
+    // Texel Containing The Sample and The Position Inside It
+    vec2 texSize = vec2(textureSize(tex, 0));
+    vec2 samplePos = uv * texSize;
+    vec2 texPos1 = floor(samplePos - 0.5f) + 0.5f;
+    vec2 f = samplePos - texPos1;
+
+    // Catmull-Rom Weights of The Four Texels Along Each Axis
+    vec2 w0 = f * (-0.5f + f * (1.0f - 0.5f * f));
+    vec2 w1 = 1.0f + f * f * (-2.5f + 1.5f * f);
+    vec2 w2 = f * (0.5f + f * (2.0f - 1.5f * f));
+    vec2 w3 = f * f * (-0.5f + 0.5f * f);
+
+    // The Middle Two Texels Are Read With One Bilinear Tap Placed Between Them
+    vec2 w12 = w1 + w2;
+    vec2 texPos0 = (texPos1 - 1.0f) / texSize;
+    vec2 texPos3 = (texPos1 + 2.0f) / texSize;
+    vec2 texPos12 = (texPos1 + w2 / w12) / texSize;
+
+    vec4 result = vec4(0.0f);
+    result += texture(tex, vec2(texPos0.x, texPos0.y)) * w0.x * w0.y;
+    result += texture(tex, vec2(texPos12.x, texPos0.y)) * w12.x * w0.y;
+    result += texture(tex, vec2(texPos3.x, texPos0.y)) * w3.x * w0.y;
+    result += texture(tex, vec2(texPos0.x, texPos12.y)) * w0.x * w12.y;
+    result += texture(tex, vec2(texPos12.x, texPos12.y)) * w12.x * w12.y;
+    result += texture(tex, vec2(texPos3.x, texPos12.y)) * w3.x * w12.y;
+    result += texture(tex, vec2(texPos0.x, texPos3.y)) * w0.x * w3.y;
+    result += texture(tex, vec2(texPos12.x, texPos3.y)) * w12.x * w3.y;
+    result += texture(tex, vec2(texPos3.x, texPos3.y)) * w3.x * w3.y;
+
+    // Negative Lobes Can Undershoot Next to Hard Edges
+    return max(result, vec4(0.0f));
+}
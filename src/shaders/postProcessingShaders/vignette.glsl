@@ -0,0 +1,10 @@
+// Vignette - Darkens Towards The Corners, Fully Dark Past radius + softness From The Center
+uniform float vignetteIntensity;
+uniform float vignetteRadius;
+uniform float vignetteSoftness;
+
+vec3 applyVignette(vec3 color, vec2 uv) {
+    float distanceFromCenter = length(uv - 0.5f) * 1.41421356f;
+    float vignette = 1.0f - smoothstep(vignetteRadius, vignetteRadius + vignetteSoftness, distanceFromCenter);
+    return color * mix(1.0f, vignette, vignetteIntensity);
+}
@@ -6,15 +6,21 @@ layout(location = 0) in vec3 vertexPosition;
 // Uniform Variables
 uniform mat4 pv;
 
+// Vertex Decoding - Identity For Float32 Meshes
+uniform vec3 dequantOffset, dequantScale;
+
 // Output
 out vec3 texCords;
 
 // Main
 void main(void) {
+    // Dequantize Vertex Position
+    vec3 position = dequantOffset + vertexPosition * dequantScale;
+
     // Calculate and Set Final Vertex Position
-    vec4 pos = pv * vec4(vertexPosition, 1.0f);
+    vec4 pos = pv * vec4(position, 1.0f);
     gl_Position = pos.xyww;
 
     // Send Texture Coordinates to Fragment Shader
-    texCords = vertexPosition;
+    texCords = position;
 }
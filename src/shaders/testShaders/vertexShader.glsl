@@ -1,4 +1,4 @@
-#version 460 core
+#version 450 core
 
 // Vertex Attributes
 layout(location = 0) in vec3 vertexPosition;
@@ -8,16 +8,28 @@ layout(location = 2) in vec2 textureCoords;
 // Uniform Variables
 uniform mat4 pvm;
 
+// Vertex Decoding - Identity For Float32 Meshes
+uniform vec3 dequantOffset, dequantScale;
+uniform bool octahedralNormals;
+
 // Output
 out vec3 normalVec;
 out vec2 texCords;
 
+// Decode Octahedral Encoded Normal Vector
+vec3 octahedralDecode(vec2 encoded) {
+    vec3 normalVector = vec3(encoded, 1.0f - abs(encoded.x) - abs(encoded.y));
+    float t = max(-normalVector.z, 0.0f);
+    normalVector.xy += vec2(normalVector.x >= 0.0f ? -t : t, normalVector.y >= 0.0f ? -t : t);
+    return normalize(normalVector);
+}
+
 // Main
 void main(void) {
     // Calculate and Set Final Vertex Position
-    gl_Position = pvm * vec4(vertexPosition, 1.0f);
+    gl_Position = pvm * vec4(dequantOffset + vertexPosition * dequantScale, 1.0f);
 
     // Send Normal Vector and Texture Coordinates to Fragment Shader
-    normalVec = normalVector;
+    normalVec = octahedralNormals ? octahedralDecode(normalVector.xy) : normalVector;
     texCords = textureCoords;
 }